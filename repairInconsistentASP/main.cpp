@@ -10,7 +10,32 @@
 #include <iomanip>
 #include <fstream>
 #include <vector>
+#include <unordered_set>
+#include <string>
+#include <sstream>
 #include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <type_traits>
+#include <algorithm>
+#include <functional>
+#include <charconv>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <signal.h>
+
+#ifdef USE_CLINGO
+#include <clingo.h>
+#endif
 
 enum EDGE_TYPE
 {
@@ -30,6 +55,15 @@ enum
     CORRUPTED = 1,
 };
 
+enum CONFLICT_TYPE
+{
+    LACKS_ACTIVATOR = 0,    // becomes active in the table, but nothing activates it
+    LACKS_INHIBITOR,        // becomes inactive in the table, but nothing inhibits it
+    CONFLICTING_SIGNALS,    // changes state in the table, but is both activated and inhibited
+    UNEXPECTED_ACTIVATION,  // stays inactive in the table, but is activated
+    UNEXPECTED_INHIBITION,  // stays active in the table, but is inhibited
+};
+
 struct Edge
 {
     Edge(int Type, unsigned int From, unsigned int To)
@@ -63,1488 +97,3186 @@ struct TableElement
     unsigned int time;
 };
 
-struct GeneNetwork
+inline unsigned int CountBits(uint64_t word)
 {
-    GeneNetwork()
+    return (unsigned int)__builtin_popcountll(word);
+}
+
+inline unsigned int CountBits(const uint64_t *words, size_t wordsNum)
+{
+    unsigned int bits = 0;
+    
+    for(size_t i = 0; i < wordsNum; ++i)
+        bits += CountBits(words[i]);
+    
+    return bits;
+}
+
+// gene x time bit-matrix of the timeseries table
+// for every time step there is one bitset of active genes and one of inactive genes (gene G is bit G-1),
+// each row starting on a 64-bit word so rows can be combined a word at a time
+struct TableMatrix
+{
+    TableMatrix()
     {
-        timeSteps = 0;
         geneNum = 0;
+        timeSteps = 0;
+        wordsPerRow = 0;
+    }
+    
+    void Build(unsigned int GeneNum, unsigned int TimeSteps, const std::vector<TableElement> &table)
+    {
+        geneNum = GeneNum;
+        timeSteps = TimeSteps;
+        wordsPerRow = (geneNum + 63) / 64;
         
-        kDegree = 0.0f;
+        active.assign(wordsPerRow * timeSteps, 0);
+        inactive.assign(wordsPerRow * timeSteps, 0);
+        
+        size_t tableSize = table.size();
+        for(size_t i = 0; i < tableSize; ++i)
+        {
+            unsigned int gene = table[i].gene;
+            unsigned int time = table[i].time;
+            
+            // ignore entries outside of the network (LoadNetworks' safety check reports those)
+            if(gene < 1 || gene > geneNum || time < 1 || time > timeSteps)
+                continue;
+            
+            uint64_t *row = (table[i].type == ACTIVE) ? ActiveRow(time) : InactiveRow(time);
+            
+            row[(gene - 1) / 64] |= (uint64_t)1 << ((gene - 1) % 64);
+        }
     }
     
-    GeneNetwork(GeneNetwork& rhs)
+    bool IsActive(unsigned int gene, unsigned int time) const
     {
-        name = rhs.name;
+        return (ActiveRow(time)[(gene - 1) / 64] >> ((gene - 1) % 64)) & 1;
+    }
+    
+    bool IsInactive(unsigned int gene, unsigned int time) const
+    {
+        return (InactiveRow(time)[(gene - 1) / 64] >> ((gene - 1) % 64)) & 1;
+    }
+    
+    // rows of time steps 1..timeSteps
+    uint64_t *ActiveRow(unsigned int time) { return &active[(time - 1) * wordsPerRow]; }
+    uint64_t *InactiveRow(unsigned int time) { return &inactive[(time - 1) * wordsPerRow]; }
+    
+    const uint64_t *ActiveRow(unsigned int time) const { return &active[(time - 1) * wordsPerRow]; }
+    const uint64_t *InactiveRow(unsigned int time) const { return &inactive[(time - 1) * wordsPerRow]; }
+    
+    unsigned int geneNum;
+    unsigned int timeSteps;
+    size_t wordsPerRow;
+    
+    std::vector<uint64_t> active;
+    std::vector<uint64_t> inactive;
+};
+
+// compressed-sparse-row adjacency of a network (genes are 1..geneNum, row 0 stays empty)
+// out-neighbours of gene G are outTargets[outOffsets[G] .. outOffsets[G+1]), in-neighbours are stored the same way
+struct AdjacencyIndex
+{
+    AdjacencyIndex()
+    {
+        geneNum = 0;
+    }
+    
+    void Build(unsigned int GeneNum, const std::vector<Edge> &edges)
+    {
+        geneNum = GeneNum;
         
-        timeSteps = rhs.timeSteps;
-        for(size_t i = 0; i < rhs.table.size(); ++i)
-            table.push_back(rhs.table[i]);
+        outOffsets.assign(geneNum + 2, 0);
+        inOffsets.assign(geneNum + 2, 0);
         
-        geneNum = rhs.geneNum;
+        // count degrees, then turn the counts into row offsets
+        size_t edgesNum = edges.size();
+        for(size_t i = 0; i < edgesNum; ++i)
+        {
+            if(!IsInNetwork(edges[i]))
+                continue;
+            
+            ++outOffsets[edges[i].from + 1];
+            ++inOffsets[edges[i].to + 1];
+        }
         
-        for(size_t i = 0; i < rhs.edges.size(); ++i)
-            edges.push_back(rhs.edges[i]);
+        for(unsigned int gene = 1; gene <= geneNum + 1; ++gene)
+        {
+            outOffsets[gene] += outOffsets[gene - 1];
+            inOffsets[gene] += inOffsets[gene - 1];
+        }
         
-        for(size_t i = 0; i < rhs.addedEdges.size(); ++i)
-            addedEdges.push_back(rhs.addedEdges[i]);
+        outTargets.resize(outOffsets[geneNum + 1]);
+        outTypes.resize(outOffsets[geneNum + 1]);
+        inSources.resize(inOffsets[geneNum + 1]);
+        inTypes.resize(inOffsets[geneNum + 1]);
         
-        kDegree = rhs.kDegree;
-        edgesNodesRatio = rhs.edgesNodesRatio;
-        diameter = rhs.diameter;
+        std::vector<unsigned int> outNext(outOffsets.begin(), outOffsets.end() - 1);
+        std::vector<unsigned int> inNext(inOffsets.begin(), inOffsets.end() - 1);
         
+        for(size_t i = 0; i < edgesNum; ++i)
+        {
+            if(!IsInNetwork(edges[i]))
+                continue;
+            
+            unsigned int outPosition = outNext[edges[i].from]++;
+            outTargets[outPosition] = edges[i].to;
+            outTypes[outPosition] = edges[i].type;
+            
+            unsigned int inPosition = inNext[edges[i].to]++;
+            inSources[inPosition] = edges[i].from;
+            inTypes[inPosition] = edges[i].type;
+        }
     }
     
-    void LearnProperties()
+    bool IsInNetwork(const Edge &edge) const
     {
-        if(edges.empty())
-        {
-            std::cout << "\nERROR: Network not loaded, can't learn properties...\n\n";
-            return;
-        }
-        
-        CalculateKDegree();
-        CalculateEdgesNodesRatio();
+        return (edge.from >= 1) && (edge.from <= geneNum) && (edge.to >= 1) && (edge.to <= geneNum);
     }
     
-    void CalculateKDegree()
+    unsigned int OutDegree(unsigned int gene) const { return outOffsets[gene + 1] - outOffsets[gene]; }
+    unsigned int InDegree(unsigned int gene) const { return inOffsets[gene + 1] - inOffsets[gene]; }
+    unsigned int Degree(unsigned int gene) const { return OutDegree(gene) + InDegree(gene); }
+    
+    unsigned int geneNum;
+    
+    std::vector<unsigned int> outOffsets;
+    std::vector<unsigned int> outTargets;
+    std::vector<int> outTypes;
+    
+    std::vector<unsigned int> inOffsets;
+    std::vector<unsigned int> inSources;
+    std::vector<int> inTypes;
+};
+
+// networks up to this many genes use a bitmap in EdgeSet (2 * 8192^2 bits = 16MB), bigger ones a hash set
+const unsigned int EDGE_SET_MAX_BITMAP_GENES = 8191;
+
+// set of edges with O(1) membership tests, keyed on (type, from, to)
+struct EdgeSet
+{
+    EdgeSet()
     {
-        unsigned int kDegrees = 0;
+        geneNum = 0;
+    }
+    
+    void Build(const std::vector<Edge> &edges)
+    {
+        geneNum = 0;
+        
+        for(size_t i = 0; i < edges.size(); ++i)
+            geneNum = std::max(geneNum, std::max(edges[i].from, edges[i].to));
         
-        for(size_t i = 1; i <= geneNum; ++i)
+        bitmap.clear();
+        hashedEdges.clear();
+        
+        if(geneNum <= EDGE_SET_MAX_BITMAP_GENES)
         {
-            unsigned int geneKDegree = 0;
+            bitmap.assign((EdgeId(INHIBITS, geneNum, geneNum) + 64) / 64, 0);
             
-            for(size_t j = 0; j < edges.size(); ++j)
+            for(size_t i = 0; i < edges.size(); ++i)
             {
-                if(edges[j].from == i)
-                    ++geneKDegree;
-                
-                if(edges[j].to == i)
-                    ++geneKDegree;
+                uint64_t id = EdgeId(edges[i].type, edges[i].from, edges[i].to);
+                bitmap[id / 64] |= (uint64_t)1 << (id % 64);
             }
+        }
+        else
+        {
+            hashedEdges.reserve(edges.size());
             
-            kDegrees += geneKDegree;
+            for(size_t i = 0; i < edges.size(); ++i)
+                hashedEdges.insert(EdgeId(edges[i].type, edges[i].from, edges[i].to));
         }
-        
-        kDegree = (float)kDegrees / (float)geneNum;
     }
     
-    void CalculateEdgesNodesRatio()
+    uint64_t EdgeId(int type, unsigned int from, unsigned int to) const
     {
-        edgesNodesRatio = (float)edges.size() / (float)geneNum;
+        uint64_t side = (uint64_t)geneNum + 1;
+        
+        return ((uint64_t)(type == INHIBITS) * side + from) * side + to;
     }
     
-    void PrintProperties()
+    bool Contains(const Edge &edge) const
     {
-        if(edges.empty())
-        {
-            std::cout << "\nERROR: Network not loaded, can't print properties...\n\n";
-            return;
-        }
+        if(edge.from > geneNum || edge.to > geneNum)
+            return false;
         
-        std::cout << "\n\nNetwork: " << name << "\n";
-        std::cout << "\nNb. of nodes = " << geneNum << "\n";
-        std::cout << "\nNb. of edges = " << edges.size() << "\n";
-        std::cout << "\nEdges-Nodes Ratio = " << edgesNodesRatio << "\n";
-        std::cout << "\nAverage K degree of all nodes = " << kDegree << "\n";
-        std::cout << "\nDiameter = " << diameter << "\n\n\n";
+        uint64_t id = EdgeId(edge.type, edge.from, edge.to);
+        
+        if(!bitmap.empty())
+            return (bitmap[id / 64] >> (id % 64)) & 1;
+        
+        return hashedEdges.count(id) != 0;
     }
     
-    std::string name;
-    
-    unsigned int timeSteps;
-    std::vector<TableElement> table;
+    // number of given edges that are in the set
+    size_t CountCommon(const std::vector<Edge> &edges) const
+    {
+        size_t common = 0;
+        
+        for(size_t i = 0; i < edges.size(); ++i)
+            common += Contains(edges[i]);
+        
+        return common;
+    }
     
     unsigned int geneNum;
-    std::vector<Edge> edges;
-    std::vector<Edge> addedEdges; // edges added to corrupt the network
     
-    float kDegree; // average of number of total edges connected to a node
-    float edgesNodesRatio; // ratio of edges per node
-    unsigned int diameter; // diameter of the network (largest value of smallest distances between every pair of nodes)
+    std::vector<uint64_t> bitmap;
+    std::unordered_set<uint64_t> hashedEdges;
 };
 
+// networks with more genes than this get a double-sweep approximation of their diameter in LearnProperties()
+const unsigned int DIAMETER_EXACT_MAX_GENES = 50000;
 
-
-
-struct Repair
+// undirected neighbours of every gene, the "link" relation of CreateASPfile's rule 5 (self loops are dropped)
+void BuildLinkAdjacency(const AdjacencyIndex &adjacency, std::vector<unsigned int> &linkOffsets, std::vector<unsigned int> &links)
 {
-    Repair(unsigned int r0 = 0, unsigned int r1 = 0, unsigned int r2 = 0, unsigned int r3 = 0, unsigned int r4 = 0, unsigned int r5 = 0, unsigned int r6 = 0)
+    unsigned int geneNum = adjacency.geneNum;
+    
+    linkOffsets.assign(geneNum + 2, 0);
+    links.clear();
+    links.reserve(adjacency.outTargets.size() + adjacency.inSources.size());
+    
+    for(unsigned int gene = 1; gene <= geneNum; ++gene)
     {
-        ruleViolations[0] = r0;
-        ruleViolations[1] = r1;
-        ruleViolations[2] = r2;
-        ruleViolations[3] = r3;
-        ruleViolations[4] = r4;
-        ruleViolations[5] = r5;
-        ruleViolations[6] = r6;
+        linkOffsets[gene] = (unsigned int)links.size();
         
-        for(size_t i = 0; i < 7; ++i)
-            zScores[i] = 0.0f;
+        for(unsigned int i = adjacency.outOffsets[gene]; i < adjacency.outOffsets[gene + 1]; ++i)
+        {
+            if(adjacency.outTargets[i] != gene)
+                links.push_back(adjacency.outTargets[i]);
+        }
         
-        totalZScore = 0.0f;
+        for(unsigned int i = adjacency.inOffsets[gene]; i < adjacency.inOffsets[gene + 1]; ++i)
+        {
+            if(adjacency.inSources[i] != gene)
+                links.push_back(adjacency.inSources[i]);
+        }
     }
     
-    unsigned int ruleViolations[7];
-    float zScores[7];
-    
-    float totalZScore;
-};
-
-
-
-
-
+    linkOffsets[geneNum + 1] = (unsigned int)links.size();
+}
 
+// breadth-first search from up to 64 sources at once: bit i of a gene's word says whether source i reached it
+// returns the largest distance at which any of the sources still reached a new gene
+unsigned int MultiSourceEccentricity(const std::vector<unsigned int> &linkOffsets, const std::vector<unsigned int> &links, unsigned int firstSource, unsigned int sourcesNum,
+                                     std::vector<uint64_t> &visited, std::vector<uint64_t> &frontier, std::vector<uint64_t> &next)
+{
+    size_t genesNum = linkOffsets.size() - 1;
+    
+    visited.assign(genesNum, 0);
+    frontier.assign(genesNum, 0);
+    next.assign(genesNum, 0);
+    
+    for(unsigned int i = 0; i < sourcesNum; ++i)
+    {
+        visited[firstSource + i] = (uint64_t)1 << i;
+        frontier[firstSource + i] = (uint64_t)1 << i;
+    }
+    
+    unsigned int distance = 0;
+    
+    while(true)
+    {
+        uint64_t reachedAny = 0;
+        
+        for(size_t gene = 1; gene < genesNum; ++gene)
+        {
+            uint64_t reached = 0;
+            
+            for(unsigned int i = linkOffsets[gene]; i < linkOffsets[gene + 1]; ++i)
+                reached |= frontier[links[i]];
+            
+            reached &= ~visited[gene];
+            
+            next[gene] = reached;
+            reachedAny |= reached;
+        }
+        
+        if(reachedAny == 0)
+            return distance;
+        
+        ++distance;
+        
+        for(size_t gene = 1; gene < genesNum; ++gene)
+            visited[gene] |= next[gene];
+        
+        frontier.swap(next);
+    }
+}
 
-GeneNetwork budding;
-GeneNetwork fission;
-GeneNetwork elegans;
-GeneNetwork mammalian;
-GeneNetwork arabidopsis;
-GeneNetwork thcell;
+// plain breadth-first search, returns the eccentricity of the source and the last gene reached
+unsigned int SingleSourceEccentricity(const std::vector<unsigned int> &linkOffsets, const std::vector<unsigned int> &links, unsigned int source, unsigned int &farthestGene)
+{
+    std::vector<unsigned int> distances(linkOffsets.size() - 1, (unsigned int)-1);
+    std::vector<unsigned int> queue;
+    
+    queue.reserve(distances.size());
+    queue.push_back(source);
+    distances[source] = 0;
+    
+    farthestGene = source;
+    
+    for(size_t head = 0; head < queue.size(); ++head)
+    {
+        unsigned int gene = queue[head];
+        
+        farthestGene = gene;
+        
+        for(unsigned int i = linkOffsets[gene]; i < linkOffsets[gene + 1]; ++i)
+        {
+            if(distances[links[i]] == (unsigned int)-1)
+            {
+                distances[links[i]] = distances[gene] + 1;
+                queue.push_back(links[i]);
+            }
+        }
+    }
+    
+    return distances[farthestGene];
+}
 
+// diameter of the link graph: largest shortest distance between two genes that can reach each other
+// exact: bit-parallel BFS from every gene (64 sources per pass, passes spread over all cores)
+// approximate: double sweep (BFS from the first linked gene, then from the farthest gene found), a lower bound of the diameter
+unsigned int ComputeDiameter(const AdjacencyIndex &adjacency, bool approximate)
+{
+    unsigned int geneNum = adjacency.geneNum;
+    
+    std::vector<unsigned int> linkOffsets;
+    std::vector<unsigned int> links;
+    
+    BuildLinkAdjacency(adjacency, linkOffsets, links);
+    
+    if(approximate)
+    {
+        unsigned int start = 1;
+        
+        while(start < geneNum && linkOffsets[start] == linkOffsets[start + 1])
+            ++start;
+        
+        unsigned int farthestGene = start;
+        SingleSourceEccentricity(linkOffsets, links, start, farthestGene);
+        
+        return SingleSourceEccentricity(linkOffsets, links, farthestGene, farthestGene);
+    }
+    
+    unsigned int batchesNum = (geneNum + 63) / 64;
+    unsigned int threadsNum = std::max(1u, std::min(std::thread::hardware_concurrency(), batchesNum));
+    
+    std::atomic<unsigned int> nextBatch(0);
+    std::vector<unsigned int> threadDiameters(threadsNum, 0);
+    std::vector<std::thread> threads;
+    
+    for(unsigned int t = 0; t < threadsNum; ++t)
+    {
+        threads.push_back(std::thread([&, t]()
+        {
+            std::vector<uint64_t> visited;
+            std::vector<uint64_t> frontier;
+            std::vector<uint64_t> next;
+            
+            unsigned int batch;
+            while((batch = nextBatch++) < batchesNum)
+            {
+                unsigned int firstSource = 1 + batch * 64;
+                unsigned int sourcesNum = std::min(64u, geneNum + 1 - firstSource);
+                
+                unsigned int eccentricity = MultiSourceEccentricity(linkOffsets, links, firstSource, sourcesNum, visited, frontier, next);
+                
+                threadDiameters[t] = std::max(threadDiameters[t], eccentricity);
+            }
+        }));
+    }
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+    
+    return *std::max_element(threadDiameters.begin(), threadDiameters.end());
+}
 
+// 3-node motifs of CreateASPfile's rule 6: motif3(I,X,Y,Z) for distinct genes X, Y, Z
+// each class fixes edge(X,Y), edge(Y,X), edge(X,Z), edge(Z,X), edge(Y,Z), edge(Z,Y) (1 = edge, 0 = no edge)
+const unsigned int MOTIF3_CLASSES_NUM = 13;
 
+const unsigned char MOTIF3_CLASSES[MOTIF3_CLASSES_NUM + 1][6] =
+{
+    {0, 0, 0, 0, 0, 0}, // unused
+    {1, 0, 1, 0, 0, 0},
+    {0, 1, 1, 0, 0, 0},
+    {1, 1, 1, 0, 0, 0},
+    {0, 0, 1, 0, 1, 0},
+    {1, 0, 1, 0, 1, 0},
+    {1, 1, 1, 0, 1, 0},
+    {1, 1, 0, 1, 0, 0},
+    {1, 1, 1, 1, 0, 0},
+    {1, 0, 0, 1, 1, 0},
+    {1, 0, 1, 1, 1, 0},
+    {0, 1, 1, 1, 1, 0},
+    {1, 1, 1, 1, 1, 0},
+    {1, 1, 1, 1, 1, 1},
+};
 
+// classes 8, 9 and 13 are commented out in the rule of thumb, so they don't count as dominant motifs
+const bool MOTIF3_IN_RULE_OF_THUMB[MOTIF3_CLASSES_NUM + 1] = {false, true, true, true, true, true, true, true, false, false, true, true, true, false};
 
+// networks with more genes than this get their motif count as a fact in the ASP file instead of the motif3 rules
+const unsigned int MOTIF_RULES_MAX_GENES = 64;
 
+// triad census: number of (X,Y,Z) triples matching each motif3 class, exactly as gringo grounds the rules
+// (motifCounts[0] is unused). For every pair (X,Y) the genes Z of a class are found with one AND of
+// the adjacency bitsets of X and Y per word, and the pairs are spread over all cores by X.
+void ComputeTriadCensus(const AdjacencyIndex &adjacency, std::vector<uint64_t> &motifCounts)
+{
+    unsigned int geneNum = adjacency.geneNum;
+    
+    motifCounts.assign(MOTIF3_CLASSES_NUM + 1, 0);
+    
+    if(geneNum < 3)
+        return;
+    
+    // out[G] has bit Z-1 set if edge(G,Z), in[G] has bit Z-1 set if edge(Z,G)
+    size_t wordsPerRow = (geneNum + 63) / 64;
+    
+    std::vector<uint64_t> outBits((geneNum + 1) * wordsPerRow, 0);
+    std::vector<uint64_t> inBits((geneNum + 1) * wordsPerRow, 0);
+    
+    for(unsigned int gene = 1; gene <= geneNum; ++gene)
+    {
+        for(unsigned int i = adjacency.outOffsets[gene]; i < adjacency.outOffsets[gene + 1]; ++i)
+        {
+            unsigned int target = adjacency.outTargets[i];
+            
+            outBits[gene * wordsPerRow + (target - 1) / 64] |= (uint64_t)1 << ((target - 1) % 64);
+            inBits[target * wordsPerRow + (gene - 1) / 64] |= (uint64_t)1 << ((gene - 1) % 64);
+        }
+    }
+    
+    uint64_t lastWordMask = (geneNum % 64 == 0) ? ~(uint64_t)0 : (((uint64_t)1 << (geneNum % 64)) - 1);
+    
+    unsigned int threadsNum = std::max(1u, std::min(std::thread::hardware_concurrency(), geneNum));
+    
+    std::atomic<unsigned int> nextGene(1);
+    std::vector<std::vector<uint64_t> > threadCounts(threadsNum, std::vector<uint64_t>(MOTIF3_CLASSES_NUM + 1, 0));
+    std::vector<std::thread> threads;
+    
+    for(unsigned int t = 0; t < threadsNum; ++t)
+    {
+        threads.push_back(std::thread([&, t]()
+        {
+            std::vector<uint64_t> &counts = threadCounts[t];
+            
+            unsigned int x;
+            while((x = nextGene++) <= geneNum)
+            {
+                const uint64_t *outX = &outBits[x * wordsPerRow];
+                const uint64_t *inX = &inBits[x * wordsPerRow];
+                
+                for(unsigned int y = 1; y <= geneNum; ++y)
+                {
+                    if(y == x)
+                        continue;
+                    
+                    const uint64_t *outY = &outBits[y * wordsPerRow];
+                    const uint64_t *inY = &inBits[y * wordsPerRow];
+                    
+                    unsigned char xy = (outX[(y - 1) / 64] >> ((y - 1) % 64)) & 1;
+                    unsigned char yx = (inX[(y - 1) / 64] >> ((y - 1) % 64)) & 1;
+                    
+                    for(unsigned int motif = 1; motif <= MOTIF3_CLASSES_NUM; ++motif)
+                    {
+                        const unsigned char *pattern = MOTIF3_CLASSES[motif];
+                        
+                        if(pattern[0] != xy || pattern[1] != yx)
+                            continue;
+                        
+                        // an all-ones word for "no edge" literals flips the bits of the row
+                        uint64_t flipXZ = pattern[2] ? 0 : ~(uint64_t)0;
+                        uint64_t flipZX = pattern[3] ? 0 : ~(uint64_t)0;
+                        uint64_t flipYZ = pattern[4] ? 0 : ~(uint64_t)0;
+                        uint64_t flipZY = pattern[5] ? 0 : ~(uint64_t)0;
+                        
+                        uint64_t matches = 0;
+                        uint64_t wordX = 0;
+                        uint64_t wordY = 0;
+                        
+                        for(size_t w = 0; w < wordsPerRow; ++w)
+                        {
+                            uint64_t word = (outX[w] ^ flipXZ) & (inX[w] ^ flipZX) & (outY[w] ^ flipYZ) & (inY[w] ^ flipZY);
+                            
+                            if(w == wordsPerRow - 1)
+                                word &= lastWordMask;
+                            
+                            if(w == (x - 1) / 64)
+                                wordX = word;
+                            
+                            if(w == (y - 1) / 64)
+                                wordY = word;
+                            
+                            matches += CountBits(word);
+                        }
+                        
+                        // Z must be different from X and Y
+                        matches -= (wordX >> ((x - 1) % 64)) & 1;
+                        matches -= (wordY >> ((y - 1) % 64)) & 1;
+                        
+                        counts[motif] += matches;
+                    }
+                }
+            }
+        }));
+    }
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+    {
+        threads[t].join();
+        
+        for(unsigned int motif = 1; motif <= MOTIF3_CLASSES_NUM; ++motif)
+            motifCounts[motif] += threadCounts[t][motif];
+    }
+}
 
-void LoadNetworks(int Status)
+// number of motif3 atoms counted by dominantMotifs3(D) in the rule of thumb
+uint64_t CountDominantMotifs(const std::vector<uint64_t> &motifCounts)
 {
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    budding.name = "budding";
-    budding.timeSteps = 13;
-    budding.geneNum = 11;
-    budding.diameter = 3; // learned from separate ASP program
+    uint64_t dominantMotifs = 0;
     
-    if(Status == NOT_CORRUPTED)
+    for(unsigned int motif = 1; motif < motifCounts.size(); ++motif)
     {
-        // Edges of original network
-        budding.edges.push_back(Edge(ACTIVATES,1,3));
-        budding.edges.push_back(Edge(ACTIVATES,1,2));
-        budding.edges.push_back(Edge(INHIBITS,1,1));
-        budding.edges.push_back(Edge(ACTIVATES,3,4));
-        budding.edges.push_back(Edge(ACTIVATES,2,8));
-        budding.edges.push_back(Edge(INHIBITS,4,9));
-        budding.edges.push_back(Edge(INHIBITS,4,5));
-        budding.edges.push_back(Edge(INHIBITS,4,4));
-        budding.edges.push_back(Edge(ACTIVATES,8,11));
-        budding.edges.push_back(Edge(ACTIVATES,8,10));
-        budding.edges.push_back(Edge(INHIBITS,8,9));
-        budding.edges.push_back(Edge(INHIBITS,8,5));
-        budding.edges.push_back(Edge(INHIBITS,9,10));
-        budding.edges.push_back(Edge(INHIBITS,9,8));
-        budding.edges.push_back(Edge(INHIBITS,5,10));
-        budding.edges.push_back(Edge(ACTIVATES,11,10));
-        budding.edges.push_back(Edge(ACTIVATES,11,7));
-        budding.edges.push_back(Edge(ACTIVATES,11,6));
-        budding.edges.push_back(Edge(INHIBITS,11,11));
-        budding.edges.push_back(Edge(ACTIVATES,10,11));
-        budding.edges.push_back(Edge(ACTIVATES,10,7));
-        budding.edges.push_back(Edge(INHIBITS,10,3));
-        budding.edges.push_back(Edge(INHIBITS,10,2));
-        budding.edges.push_back(Edge(INHIBITS,10,9));
-        budding.edges.push_back(Edge(INHIBITS,10,5));
-        budding.edges.push_back(Edge(INHIBITS,10,6));
-        budding.edges.push_back(Edge(ACTIVATES,7,5));
-        budding.edges.push_back(Edge(ACTIVATES,7,9));
-        budding.edges.push_back(Edge(ACTIVATES,7,6));
-        budding.edges.push_back(Edge(INHIBITS,7,10));
-        budding.edges.push_back(Edge(INHIBITS,7,8));
-        budding.edges.push_back(Edge(INHIBITS,7,7));
-        budding.edges.push_back(Edge(ACTIVATES,6,9));
-        budding.edges.push_back(Edge(INHIBITS,6,6));
+        if(MOTIF3_IN_RULE_OF_THUMB[motif])
+            dominantMotifs += motifCounts[motif];
     }
-    else if(Status == CORRUPTED)
+    
+    return dominantMotifs;
+}
+
+// (gene, time) cell of the table that the edges of a network can't explain
+struct Conflict
+{
+    Conflict(int Type, unsigned int Gene, unsigned int Time)
     {
-        // Edges of original network
-        budding.edges.push_back(Edge(ACTIVATES,1,3));
-        budding.edges.push_back(Edge(ACTIVATES,1,2));
-        budding.edges.push_back(Edge(INHIBITS,1,1));
-        budding.edges.push_back(Edge(ACTIVATES,3,4));
-        //budding.edges.push_back(Edge(ACTIVATES,2,8));
-        budding.edges.push_back(Edge(INHIBITS,4,9));
-        budding.edges.push_back(Edge(INHIBITS,4,5));
-        budding.edges.push_back(Edge(INHIBITS,4,4));
-        budding.edges.push_back(Edge(ACTIVATES,8,11));
-        budding.edges.push_back(Edge(ACTIVATES,8,10));
-        budding.edges.push_back(Edge(INHIBITS,8,9));
-        budding.edges.push_back(Edge(INHIBITS,8,5));
-        budding.edges.push_back(Edge(INHIBITS,9,10));
-        //budding.edges.push_back(Edge(INHIBITS,9,8));
-        budding.edges.push_back(Edge(INHIBITS,5,10));
-        budding.edges.push_back(Edge(ACTIVATES,11,10));
-        budding.edges.push_back(Edge(ACTIVATES,11,7));
-        budding.edges.push_back(Edge(ACTIVATES,11,6));
-        budding.edges.push_back(Edge(INHIBITS,11,11));
-        //budding.edges.push_back(Edge(ACTIVATES,10,11));
-        budding.edges.push_back(Edge(ACTIVATES,10,7));
-        //budding.edges.push_back(Edge(INHIBITS,10,3));
-        //budding.edges.push_back(Edge(INHIBITS,10,2));
-        //budding.edges.push_back(Edge(INHIBITS,10,9));
-        budding.edges.push_back(Edge(INHIBITS,10,5));
-        budding.edges.push_back(Edge(INHIBITS,10,6));
-        budding.edges.push_back(Edge(ACTIVATES,7,5));
-        budding.edges.push_back(Edge(ACTIVATES,7,9));
-        budding.edges.push_back(Edge(ACTIVATES,7,6));
-        budding.edges.push_back(Edge(INHIBITS,7,10));
-        //budding.edges.push_back(Edge(INHIBITS,7,8));
-        budding.edges.push_back(Edge(INHIBITS,7,7));
-        budding.edges.push_back(Edge(ACTIVATES,6,9));
-        budding.edges.push_back(Edge(INHIBITS,6,6));
+        type = Type;
+        gene = Gene;
+        time = Time;
+    }
+    
+    int type;
+    unsigned int gene;
+    unsigned int time;
+};
+
+// synchronous update of CreateASPfile's encoding, computed for 64 genes per word:
+//   receivesActivation(Y,T) / receivesInhibition(Y,T) :- an activator / inhibitor of Y is active at T
+//   activated(Y,T) :- receivesActivation(Y,T-1), not receivesInhibition(Y,T-1) (inhibited(Y,T) likewise)
+//   Y is active at T if it was active at T-1 and isn't inhibited, or was inactive at T-1 and is activated
+//   Y is inactive at T if it was active at T-1 and is inhibited, or was inactive at T-1 and isn't activated
+// genes with no state at T-1 get no state at T
+struct BooleanNetworkSimulator
+{
+    BooleanNetworkSimulator()
+    {
+        geneNum = 0;
+        wordsPerRow = 0;
+        contradictoryEdges = false;
+    }
+    
+    void Build(unsigned int GeneNum, const std::vector<Edge> &edges)
+    {
+        geneNum = GeneNum;
+        wordsPerRow = (geneNum + 63) / 64;
+        contradictoryEdges = false;
         
+        // row X holds the genes that X activates (inhibits)
+        activatesRows.assign((geneNum + 1) * wordsPerRow, 0);
+        inhibitsRows.assign((geneNum + 1) * wordsPerRow, 0);
         
-        budding.addedEdges.push_back(Edge(ACTIVATES,1,5));
-        budding.addedEdges.push_back(Edge(ACTIVATES,1,8));
-        budding.addedEdges.push_back(Edge(ACTIVATES,1,9));
-        budding.addedEdges.push_back(Edge(ACTIVATES,1,11));
-        budding.addedEdges.push_back(Edge(ACTIVATES,2,1));
-        budding.addedEdges.push_back(Edge(ACTIVATES,2,4));
-        budding.addedEdges.push_back(Edge(ACTIVATES,3,8));
-        budding.addedEdges.push_back(Edge(ACTIVATES,7,3));
-        budding.addedEdges.push_back(Edge(ACTIVATES,7,11));
-        budding.addedEdges.push_back(Edge(ACTIVATES,9,3));
-        budding.addedEdges.push_back(Edge(INHIBITS,3,1));
-        budding.addedEdges.push_back(Edge(INHIBITS,5,8));
-        budding.addedEdges.push_back(Edge(INHIBITS,6,1));
-        budding.addedEdges.push_back(Edge(INHIBITS,6,2));
-        budding.addedEdges.push_back(Edge(INHIBITS,6,3));
-        budding.addedEdges.push_back(Edge(INHIBITS,6,4));
-        budding.addedEdges.push_back(Edge(INHIBITS,6,5));
-        budding.addedEdges.push_back(Edge(INHIBITS,6,7));
-        budding.addedEdges.push_back(Edge(INHIBITS,6,8));
-        budding.addedEdges.push_back(Edge(INHIBITS,6,10));
-        budding.addedEdges.push_back(Edge(INHIBITS,7,1));
-        budding.addedEdges.push_back(Edge(INHIBITS,7,2));
-        budding.addedEdges.push_back(Edge(INHIBITS,8,8));
-        budding.addedEdges.push_back(Edge(INHIBITS,9,11));
-        budding.addedEdges.push_back(Edge(INHIBITS,11,2));
-        budding.addedEdges.push_back(Edge(INHIBITS,11,3));
-        budding.addedEdges.push_back(Edge(INHIBITS,11,5));
-        budding.addedEdges.push_back(Edge(INHIBITS,11,9));
+        for(size_t i = 0; i < edges.size(); ++i)
+        {
+            unsigned int from = edges[i].from;
+            unsigned int to = edges[i].to;
+            
+            if(from < 1 || from > geneNum || to < 1 || to > geneNum)
+                continue;
+            
+            std::vector<uint64_t> &rows = (edges[i].type == ACTIVATES) ? activatesRows : inhibitsRows;
+            
+            rows[from * wordsPerRow + (to - 1) / 64] |= (uint64_t)1 << ((to - 1) % 64);
+        }
+        
+        // " :- activates(X,Y), inhibits(X,Y)." rejects such networks
+        for(size_t w = 0; w < activatesRows.size(); ++w)
+        {
+            if(activatesRows[w] & inhibitsRows[w])
+                contradictoryEdges = true;
+        }
     }
     
-    // Timeseries table
-    budding.table.push_back(TableElement(ACTIVE,1,1));
-    budding.table.push_back(TableElement(INACTIVE,2,1));
-    budding.table.push_back(TableElement(INACTIVE,3,1));
-    budding.table.push_back(TableElement(INACTIVE,4,1));
-    budding.table.push_back(TableElement(ACTIVE,5,1));
-    budding.table.push_back(TableElement(INACTIVE,6,1));
-    budding.table.push_back(TableElement(INACTIVE,7,1));
-    budding.table.push_back(TableElement(INACTIVE,8,1));
-    budding.table.push_back(TableElement(ACTIVE,9,1));
-    budding.table.push_back(TableElement(INACTIVE,10,1));
-    budding.table.push_back(TableElement(INACTIVE,11,1));
+    // genes receiving an activation / inhibition from the genes active in the given row
+    void ReceivedSignals(const uint64_t *active, uint64_t *receivesActivation, uint64_t *receivesInhibition) const
+    {
+        for(size_t w = 0; w < wordsPerRow; ++w)
+        {
+            receivesActivation[w] = 0;
+            receivesInhibition[w] = 0;
+        }
+        
+        for(size_t activeWord = 0; activeWord < wordsPerRow; ++activeWord)
+        {
+            uint64_t bits = active[activeWord];
+            
+            while(bits != 0)
+            {
+                unsigned int gene = (unsigned int)(activeWord * 64 + __builtin_ctzll(bits)) + 1;
+                bits &= bits - 1;
+                
+                const uint64_t *activatesRow = &activatesRows[gene * wordsPerRow];
+                const uint64_t *inhibitsRow = &inhibitsRows[gene * wordsPerRow];
+                
+                for(size_t w = 0; w < wordsPerRow; ++w)
+                {
+                    receivesActivation[w] |= activatesRow[w];
+                    receivesInhibition[w] |= inhibitsRow[w];
+                }
+            }
+        }
+    }
     
-    budding.table.push_back(TableElement(INACTIVE,1,2));
-    budding.table.push_back(TableElement(ACTIVE,2,2));
-    budding.table.push_back(TableElement(ACTIVE,3,2));
-    budding.table.push_back(TableElement(INACTIVE,4,2));
-    budding.table.push_back(TableElement(ACTIVE,5,2));
-    budding.table.push_back(TableElement(INACTIVE,6,2));
-    budding.table.push_back(TableElement(INACTIVE,7,2));
-    budding.table.push_back(TableElement(INACTIVE,8,2));
-    budding.table.push_back(TableElement(ACTIVE,9,2));
-    budding.table.push_back(TableElement(INACTIVE,10,2));
-    budding.table.push_back(TableElement(INACTIVE,11,2));
+    // one time step: state at T-1 -> state at T (receivesActivation/receivesInhibition are scratch rows)
+    void Step(const uint64_t *active, const uint64_t *inactive, uint64_t *nextActive, uint64_t *nextInactive, uint64_t *receivesActivation, uint64_t *receivesInhibition) const
+    {
+        ReceivedSignals(active, receivesActivation, receivesInhibition);
+        
+        for(size_t w = 0; w < wordsPerRow; ++w)
+        {
+            uint64_t activated = receivesActivation[w] & ~receivesInhibition[w];
+            uint64_t inhibited = receivesInhibition[w] & ~receivesActivation[w];
+            
+            nextActive[w] = (active[w] & ~inhibited) | (inactive[w] & activated);
+            nextInactive[w] = (active[w] & inhibited) | (inactive[w] & ~activated);
+        }
+    }
     
-    budding.table.push_back(TableElement(INACTIVE,1,3));
-    budding.table.push_back(TableElement(ACTIVE,2,3));
-    budding.table.push_back(TableElement(ACTIVE,3,3));
-    budding.table.push_back(TableElement(ACTIVE,4,3));
-    budding.table.push_back(TableElement(ACTIVE,5,3));
-    budding.table.push_back(TableElement(INACTIVE,6,3));
-    budding.table.push_back(TableElement(INACTIVE,7,3));
-    budding.table.push_back(TableElement(INACTIVE,8,3));
-    budding.table.push_back(TableElement(ACTIVE,9,3));
-    budding.table.push_back(TableElement(INACTIVE,10,3));
-    budding.table.push_back(TableElement(INACTIVE,11,3));
+    // number of table cells (at time steps 2..timeSteps) that contradict the state computed from the previous time step
+    // unobserved cells take the computed state, so the check matches the ASP program on incomplete tables too
+    size_t CountInconsistencies(const TableMatrix &tableMatrix) const
+    {
+        return CheckTable(tableMatrix, nullptr);
+    }
     
-    budding.table.push_back(TableElement(INACTIVE,1,4));
-    budding.table.push_back(TableElement(ACTIVE,2,4));
-    budding.table.push_back(TableElement(ACTIVE,3,4));
-    budding.table.push_back(TableElement(ACTIVE,4,4));
-    budding.table.push_back(TableElement(INACTIVE,5,4));
-    budding.table.push_back(TableElement(INACTIVE,6,4));
-    budding.table.push_back(TableElement(INACTIVE,7,4));
-    budding.table.push_back(TableElement(INACTIVE,8,4));
-    budding.table.push_back(TableElement(INACTIVE,9,4));
-    budding.table.push_back(TableElement(INACTIVE,10,4));
-    budding.table.push_back(TableElement(INACTIVE,11,4));
+    // same as CountInconsistencies(), also listing every conflicting cell and why it can't be explained
+    size_t FindConflicts(const TableMatrix &tableMatrix, std::vector<Conflict> &conflicts) const
+    {
+        conflicts.clear();
+        
+        return CheckTable(tableMatrix, &conflicts);
+    }
     
-    budding.table.push_back(TableElement(INACTIVE,1,5));
-    budding.table.push_back(TableElement(ACTIVE,2,5));
-    budding.table.push_back(TableElement(ACTIVE,3,5));
-    budding.table.push_back(TableElement(ACTIVE,4,5));
-    budding.table.push_back(TableElement(INACTIVE,5,5));
-    budding.table.push_back(TableElement(INACTIVE,6,5));
-    budding.table.push_back(TableElement(INACTIVE,7,5));
-    budding.table.push_back(TableElement(ACTIVE,8,5));
-    budding.table.push_back(TableElement(INACTIVE,9,5));
-    budding.table.push_back(TableElement(INACTIVE,10,5));
-    budding.table.push_back(TableElement(INACTIVE,11,5));
+    size_t CheckTable(const TableMatrix &tableMatrix, std::vector<Conflict> *conflicts) const
+    {
+        if(tableMatrix.timeSteps == 0)
+            return 0;
+        
+        std::vector<uint64_t> active(tableMatrix.ActiveRow(1), tableMatrix.ActiveRow(1) + wordsPerRow);
+        std::vector<uint64_t> inactive(tableMatrix.InactiveRow(1), tableMatrix.InactiveRow(1) + wordsPerRow);
+        
+        std::vector<uint64_t> nextActive(wordsPerRow);
+        std::vector<uint64_t> nextInactive(wordsPerRow);
+        std::vector<uint64_t> receivesActivation(wordsPerRow);
+        std::vector<uint64_t> receivesInhibition(wordsPerRow);
+        
+        size_t inconsistencies = 0;
+        
+        for(unsigned int time = 2; time <= tableMatrix.timeSteps; ++time)
+        {
+            Step(active.data(), inactive.data(), nextActive.data(), nextInactive.data(), receivesActivation.data(), receivesInhibition.data());
+            
+            const uint64_t *observedActive = tableMatrix.ActiveRow(time);
+            const uint64_t *observedInactive = tableMatrix.InactiveRow(time);
+            
+            for(size_t w = 0; w < wordsPerRow; ++w)
+            {
+                uint64_t shouldBeActive = observedActive[w] & nextInactive[w];
+                uint64_t shouldBeInactive = observedInactive[w] & nextActive[w];
+                
+                inconsistencies += CountBits(shouldBeActive | shouldBeInactive);
+                
+                if(conflicts != nullptr && (shouldBeActive | shouldBeInactive) != 0)
+                {
+                    uint64_t bothSignals = receivesActivation[w] & receivesInhibition[w];
+                    
+                    uint64_t typeBits[5];
+                    
+                    typeBits[LACKS_ACTIVATOR] = shouldBeActive & inactive[w] & ~bothSignals;
+                    typeBits[LACKS_INHIBITOR] = shouldBeInactive & active[w] & ~bothSignals;
+                    typeBits[CONFLICTING_SIGNALS] = ((shouldBeActive & inactive[w]) | (shouldBeInactive & active[w])) & bothSignals;
+                    typeBits[UNEXPECTED_ACTIVATION] = shouldBeInactive & inactive[w];
+                    typeBits[UNEXPECTED_INHIBITION] = shouldBeActive & active[w];
+                    
+                    for(int type = LACKS_ACTIVATOR; type <= UNEXPECTED_INHIBITION; ++type)
+                    {
+                        uint64_t bits = typeBits[type];
+                        
+                        while(bits != 0)
+                        {
+                            unsigned int gene = (unsigned int)(w * 64 + __builtin_ctzll(bits)) + 1;
+                            bits &= bits - 1;
+                            
+                            conflicts->push_back(Conflict(type, gene, time));
+                        }
+                    }
+                }
+                
+                uint64_t observed = observedActive[w] | observedInactive[w];
+                
+                active[w] = observedActive[w] | (nextActive[w] & ~observed);
+                inactive[w] = observedInactive[w] | (nextInactive[w] & ~observed);
+            }
+        }
+        
+        return inconsistencies;
+    }
     
-    budding.table.push_back(TableElement(INACTIVE,1,6));
-    budding.table.push_back(TableElement(ACTIVE,2,6));
-    budding.table.push_back(TableElement(ACTIVE,3,6));
-    budding.table.push_back(TableElement(ACTIVE,4,6));
-    budding.table.push_back(TableElement(INACTIVE,5,6));
-    budding.table.push_back(TableElement(INACTIVE,6,6));
-    budding.table.push_back(TableElement(INACTIVE,7,6));
-    budding.table.push_back(TableElement(ACTIVE,8,6));
-    budding.table.push_back(TableElement(INACTIVE,9,6));
-    budding.table.push_back(TableElement(ACTIVE,10,6));
-    budding.table.push_back(TableElement(ACTIVE,11,6));
+    // true if the ASP program restricted to these edges (no repairs) would be satisfiable
+    bool IsConsistent(const TableMatrix &tableMatrix) const
+    {
+        return !contradictoryEdges && (CountInconsistencies(tableMatrix) == 0);
+    }
     
-    budding.table.push_back(TableElement(INACTIVE,1,7));
-    budding.table.push_back(TableElement(INACTIVE,2,7));
-    budding.table.push_back(TableElement(INACTIVE,3,7));
-    budding.table.push_back(TableElement(ACTIVE,4,7));
-    budding.table.push_back(TableElement(INACTIVE,5,7));
-    budding.table.push_back(TableElement(INACTIVE,6,7));
-    budding.table.push_back(TableElement(ACTIVE,7,7));
-    budding.table.push_back(TableElement(ACTIVE,8,7));
-    budding.table.push_back(TableElement(INACTIVE,9,7));
-    budding.table.push_back(TableElement(ACTIVE,10,7));
-    budding.table.push_back(TableElement(ACTIVE,11,7));
+    unsigned int geneNum;
+    size_t wordsPerRow;
     
-    budding.table.push_back(TableElement(INACTIVE,1,8));
-    budding.table.push_back(TableElement(INACTIVE,2,8));
-    budding.table.push_back(TableElement(INACTIVE,3,8));
-    budding.table.push_back(TableElement(INACTIVE,4,8));
-    budding.table.push_back(TableElement(INACTIVE,5,8));
-    budding.table.push_back(TableElement(INACTIVE,6,8));
-    budding.table.push_back(TableElement(ACTIVE,7,8));
-    budding.table.push_back(TableElement(INACTIVE,8,8));
-    budding.table.push_back(TableElement(INACTIVE,9,8));
-    budding.table.push_back(TableElement(ACTIVE,10,8));
-    budding.table.push_back(TableElement(ACTIVE,11,8));
+    bool contradictoryEdges; // the same pair of genes both activates and inhibits
     
-    budding.table.push_back(TableElement(INACTIVE,1,9));
-    budding.table.push_back(TableElement(INACTIVE,2,9));
-    budding.table.push_back(TableElement(INACTIVE,3,9));
-    budding.table.push_back(TableElement(INACTIVE,4,9));
-    budding.table.push_back(TableElement(INACTIVE,5,9));
-    budding.table.push_back(TableElement(INACTIVE,6,9));
-    budding.table.push_back(TableElement(ACTIVE,7,9));
-    budding.table.push_back(TableElement(INACTIVE,8,9));
-    budding.table.push_back(TableElement(INACTIVE,9,9));
-    budding.table.push_back(TableElement(ACTIVE,10,9));
-    budding.table.push_back(TableElement(ACTIVE,11,9));
+    std::vector<uint64_t> activatesRows;
+    std::vector<uint64_t> inhibitsRows;
+};
+
+// *************************************************************************************************
+// Tracing: scoped timers around the phases of a run (loading, learning, ASP file, grounding, solving,
+// parsing, statistics), with counters such as bytes written and read, models parsed and edges compared.
+// Nothing is recorded unless tracingEnabled is set; WriteTrace() then exports every event in the
+// Chrome trace-event format (chrome://tracing, ui.perfetto.dev), one track per thread.
+// *************************************************************************************************
+
+bool tracingEnabled = false;
+
+struct TraceEvent
+{
+    const char *name;
+    std::string detail; // e.g. the file worked on
     
-    budding.table.push_back(TableElement(INACTIVE,1,10));
-    budding.table.push_back(TableElement(INACTIVE,2,10));
-    budding.table.push_back(TableElement(INACTIVE,3,10));
-    budding.table.push_back(TableElement(INACTIVE,4,10));
-    budding.table.push_back(TableElement(INACTIVE,5,10));
-    budding.table.push_back(TableElement(INACTIVE,6,10));
-    budding.table.push_back(TableElement(ACTIVE,7,10));
-    budding.table.push_back(TableElement(INACTIVE,8,10));
-    budding.table.push_back(TableElement(INACTIVE,9,10));
-    budding.table.push_back(TableElement(ACTIVE,10,10));
-    budding.table.push_back(TableElement(ACTIVE,11,10));
+    uint64_t start; // microseconds since the tracer was created
+    uint64_t duration;
+    unsigned int thread;
     
-    budding.table.push_back(TableElement(INACTIVE,1,11));
-    budding.table.push_back(TableElement(INACTIVE,2,11));
-    budding.table.push_back(TableElement(INACTIVE,3,11));
-    budding.table.push_back(TableElement(INACTIVE,4,11));
-    budding.table.push_back(TableElement(INACTIVE,5,11));
-    budding.table.push_back(TableElement(INACTIVE,6,11));
-    budding.table.push_back(TableElement(ACTIVE,7,11));
-    budding.table.push_back(TableElement(INACTIVE,8,11));
-    budding.table.push_back(TableElement(INACTIVE,9,11));
-    budding.table.push_back(TableElement(ACTIVE,10,11));
-    budding.table.push_back(TableElement(ACTIVE,11,11));
+    std::vector<std::pair<const char *, uint64_t>> counters;
+};
+
+struct Tracer
+{
+    Tracer()
+    {
+        origin = std::chrono::steady_clock::now();
+        nextThread = 0;
+    }
     
-    budding.table.push_back(TableElement(INACTIVE,1,12));
-    budding.table.push_back(TableElement(INACTIVE,2,12));
-    budding.table.push_back(TableElement(INACTIVE,3,12));
-    budding.table.push_back(TableElement(INACTIVE,4,12));
-    budding.table.push_back(TableElement(INACTIVE,5,12));
-    budding.table.push_back(TableElement(INACTIVE,6,12));
-    budding.table.push_back(TableElement(ACTIVE,7,12));
-    budding.table.push_back(TableElement(INACTIVE,8,12));
-    budding.table.push_back(TableElement(INACTIVE,9,12));
-    budding.table.push_back(TableElement(ACTIVE,10,12));
-    budding.table.push_back(TableElement(ACTIVE,11,12));
+    uint64_t Now() const
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - origin).count();
+    }
     
-    budding.table.push_back(TableElement(INACTIVE,1,13));
-    budding.table.push_back(TableElement(INACTIVE,2,13));
-    budding.table.push_back(TableElement(INACTIVE,3,13));
-    budding.table.push_back(TableElement(INACTIVE,4,13));
-    budding.table.push_back(TableElement(INACTIVE,5,13));
-    budding.table.push_back(TableElement(INACTIVE,6,13));
-    budding.table.push_back(TableElement(ACTIVE,7,13));
-    budding.table.push_back(TableElement(INACTIVE,8,13));
-    budding.table.push_back(TableElement(INACTIVE,9,13));
-    budding.table.push_back(TableElement(ACTIVE,10,13));
-    budding.table.push_back(TableElement(ACTIVE,11,13));
+    // small number of the calling thread, the same for all its events
+    unsigned int ThreadIndex()
+    {
+        thread_local unsigned int index = nextThread++;
+        
+        return index;
+    }
     
-    //safety check
-    size_t buddingTableSize = budding.geneNum * budding.timeSteps;
-    size_t buddingTableElementsNum = budding.table.size();
+    void Add(TraceEvent &event)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        
+        events.push_back(std::move(event));
+    }
     
-    if(buddingTableSize != buddingTableElementsNum)
+    void Clear()
     {
-        std::cout << "\nERROR: missing entries in Budding timeseries table...\n\n";
-        return;
+        std::lock_guard<std::mutex> lock(mutex);
+        
+        events.clear();
     }
     
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    fission.name = "fission";
-    fission.timeSteps = 13;
-    fission.geneNum = 9;
-    fission.diameter = 3; // learned from separate ASP program
+    std::chrono::steady_clock::time_point origin;
+    std::atomic<unsigned int> nextThread;
     
-    if(Status == NOT_CORRUPTED)
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+};
+
+Tracer tracer;
+
+// times the scope it lives in (one "complete" trace event), Count() adds to one of its counters
+struct ScopedTimer
+{
+    ScopedTimer(const char *Name, const std::string &Detail = std::string())
     {
-        // Edges of original network
-        fission.edges.push_back(Edge(INHIBITS,1,3));
-        fission.edges.push_back(Edge(INHIBITS,1,2));
-        fission.edges.push_back(Edge(INHIBITS,1,1));
-        fission.edges.push_back(Edge(INHIBITS,2,6));
-        fission.edges.push_back(Edge(INHIBITS,2,9));
-        fission.edges.push_back(Edge(INHIBITS,3,6));
-        fission.edges.push_back(Edge(INHIBITS,3,9));
-        fission.edges.push_back(Edge(ACTIVATES,4,3));
-        fission.edges.push_back(Edge(ACTIVATES,4,2));
-        fission.edges.push_back(Edge(ACTIVATES,4,8));
-        fission.edges.push_back(Edge(INHIBITS,4,5));
-        fission.edges.push_back(Edge(INHIBITS,4,4));
-        fission.edges.push_back(Edge(ACTIVATES,5,9));
-        fission.edges.push_back(Edge(ACTIVATES,6,5));
-        fission.edges.push_back(Edge(INHIBITS,6,3));
-        fission.edges.push_back(Edge(INHIBITS,6,2));
-        fission.edges.push_back(Edge(INHIBITS,6,8));
-        fission.edges.push_back(Edge(ACTIVATES,7,4));
-        fission.edges.push_back(Edge(INHIBITS,7,6));
-        fission.edges.push_back(Edge(INHIBITS,7,9));
-        fission.edges.push_back(Edge(INHIBITS,7,7));
-        fission.edges.push_back(Edge(INHIBITS,8,9));
-        fission.edges.push_back(Edge(ACTIVATES,9,7));
-        fission.edges.push_back(Edge(INHIBITS,9,3));
-        fission.edges.push_back(Edge(INHIBITS,9,2));
+        active = tracingEnabled;
+        
+        if(!active)
+            return;
+        
+        event.name = Name;
+        event.detail = Detail;
+        event.thread = tracer.ThreadIndex();
+        event.start = tracer.Now();
     }
-    else if(Status == CORRUPTED)
+    
+    ~ScopedTimer()
     {
-        fission.edges.push_back(Edge(INHIBITS,1,3));
-        fission.edges.push_back(Edge(INHIBITS,1,2));
-        fission.edges.push_back(Edge(INHIBITS,1,1));
-        //fission.edges.push_back(Edge(INHIBITS,2,6));
-        //fission.edges.push_back(Edge(INHIBITS,2,9));
-        //fission.edges.push_back(Edge(INHIBITS,3,6));
-        //fission.edges.push_back(Edge(INHIBITS,3,9));
-        fission.edges.push_back(Edge(ACTIVATES,4,3));
-        fission.edges.push_back(Edge(ACTIVATES,4,2));
-        fission.edges.push_back(Edge(ACTIVATES,4,8));
-        fission.edges.push_back(Edge(INHIBITS,4,5));
-        fission.edges.push_back(Edge(INHIBITS,4,4));
-        fission.edges.push_back(Edge(ACTIVATES,5,9));
-        fission.edges.push_back(Edge(ACTIVATES,6,5));
-        fission.edges.push_back(Edge(INHIBITS,6,3));
-        fission.edges.push_back(Edge(INHIBITS,6,2));
-        fission.edges.push_back(Edge(INHIBITS,6,8));
-        fission.edges.push_back(Edge(ACTIVATES,7,4));
-        fission.edges.push_back(Edge(INHIBITS,7,6));
-        fission.edges.push_back(Edge(INHIBITS,7,9));
-        fission.edges.push_back(Edge(INHIBITS,7,7));
-        //fission.edges.push_back(Edge(INHIBITS,8,9));
-        fission.edges.push_back(Edge(ACTIVATES,9,7));
-        fission.edges.push_back(Edge(INHIBITS,9,3));
-        fission.edges.push_back(Edge(INHIBITS,9,2));
+        if(!active)
+            return;
         
-        fission.addedEdges.push_back(Edge(ACTIVATES,2,2));
-        fission.addedEdges.push_back(Edge(ACTIVATES,2,3));
-        fission.addedEdges.push_back(Edge(ACTIVATES,2,8));
-        fission.addedEdges.push_back(Edge(ACTIVATES,3,2));
-        fission.addedEdges.push_back(Edge(ACTIVATES,3,3));
-        fission.addedEdges.push_back(Edge(ACTIVATES,3,8));
-        fission.addedEdges.push_back(Edge(ACTIVATES,8,2));
-        fission.addedEdges.push_back(Edge(ACTIVATES,8,3));
-        fission.addedEdges.push_back(Edge(ACTIVATES,8,8));
-        fission.addedEdges.push_back(Edge(INHIBITS,3,4));
-        fission.addedEdges.push_back(Edge(INHIBITS,3,5));
-        fission.addedEdges.push_back(Edge(INHIBITS,3,7));
-        fission.addedEdges.push_back(Edge(INHIBITS,4,7));
-        fission.addedEdges.push_back(Edge(INHIBITS,7,2));
-        fission.addedEdges.push_back(Edge(INHIBITS,7,3));
-        fission.addedEdges.push_back(Edge(INHIBITS,8,1));
-        fission.addedEdges.push_back(Edge(INHIBITS,8,5));
-        fission.addedEdges.push_back(Edge(INHIBITS,8,6));
-        fission.addedEdges.push_back(Edge(INHIBITS,9,4));
-        fission.addedEdges.push_back(Edge(INHIBITS,9,9));
+        event.duration = tracer.Now() - event.start;
         
+        tracer.Add(event);
     }
     
-    // Timeseries table
-    fission.table.push_back(TableElement(ACTIVE,1,1));
-    fission.table.push_back(TableElement(ACTIVE,4,1));
-    fission.table.push_back(TableElement(ACTIVE,5,1));
-    fission.table.push_back(TableElement(INACTIVE,2,1));
-    fission.table.push_back(TableElement(INACTIVE,3,1));
-    fission.table.push_back(TableElement(INACTIVE,6,1));
-    fission.table.push_back(TableElement(INACTIVE,7,1));
-    fission.table.push_back(TableElement(INACTIVE,8,1));
-    fission.table.push_back(TableElement(INACTIVE,9,1));
-    fission.table.push_back(TableElement(INACTIVE,2,2));
-    fission.table.push_back(TableElement(INACTIVE,7,2));
-    fission.table.push_back(TableElement(INACTIVE,6,2));
-    fission.table.push_back(TableElement(INACTIVE,3,2));
-    fission.table.push_back(TableElement(INACTIVE,2,3));
-    fission.table.push_back(TableElement(INACTIVE,9,3));
-    fission.table.push_back(TableElement(INACTIVE,6,3));
-    fission.table.push_back(TableElement(INACTIVE,3,3));
-    fission.table.push_back(TableElement(INACTIVE,1,2));
-    fission.table.push_back(TableElement(INACTIVE,5,2));
-    fission.table.push_back(TableElement(INACTIVE,4,2));
-    fission.table.push_back(TableElement(ACTIVE,4,4));
-    fission.table.push_back(TableElement(ACTIVE,8,2));
-    fission.table.push_back(TableElement(ACTIVE,9,2));
-    fission.table.push_back(TableElement(INACTIVE,2,4));
-    fission.table.push_back(TableElement(INACTIVE,9,4));
-    fission.table.push_back(TableElement(INACTIVE,7,4));
-    fission.table.push_back(TableElement(INACTIVE,6,4));
-    fission.table.push_back(TableElement(INACTIVE,3,4));
-    fission.table.push_back(TableElement(INACTIVE,1,3));
-    fission.table.push_back(TableElement(INACTIVE,5,3));
-    fission.table.push_back(TableElement(INACTIVE,4,3));
-    fission.table.push_back(TableElement(ACTIVE,8,3));
-    fission.table.push_back(TableElement(INACTIVE,9,5));
-    fission.table.push_back(TableElement(INACTIVE,7,5));
-    fission.table.push_back(TableElement(INACTIVE,6,5));
-    fission.table.push_back(TableElement(INACTIVE,1,4));
-    fission.table.push_back(TableElement(INACTIVE,5,4));
-    fission.table.push_back(TableElement(ACTIVE,8,4));
-    fission.table.push_back(TableElement(INACTIVE,9,6));
-    fission.table.push_back(TableElement(INACTIVE,7,6));
-    fission.table.push_back(TableElement(INACTIVE,6,6));
-    fission.table.push_back(TableElement(INACTIVE,1,5));
-    fission.table.push_back(TableElement(INACTIVE,5,5));
-    fission.table.push_back(TableElement(INACTIVE,4,5));
-    fission.table.push_back(TableElement(ACTIVE,2,5));
-    fission.table.push_back(TableElement(ACTIVE,8,5));
-    fission.table.push_back(TableElement(ACTIVE,3,5));
-    fission.table.push_back(TableElement(ACTIVE,7,3));
-    fission.table.push_back(TableElement(INACTIVE,9,7));
-    fission.table.push_back(TableElement(INACTIVE,7,7));
-    fission.table.push_back(TableElement(INACTIVE,6,7));
-    fission.table.push_back(TableElement(INACTIVE,1,6));
-    fission.table.push_back(TableElement(INACTIVE,5,6));
-    fission.table.push_back(TableElement(INACTIVE,4,6));
-    fission.table.push_back(TableElement(ACTIVE,2,6));
-    fission.table.push_back(TableElement(ACTIVE,8,6));
-    fission.table.push_back(TableElement(ACTIVE,3,6));
-    fission.table.push_back(TableElement(INACTIVE,9,8));
-    fission.table.push_back(TableElement(INACTIVE,7,8));
-    fission.table.push_back(TableElement(INACTIVE,6,8));
-    fission.table.push_back(TableElement(INACTIVE,1,7));
-    fission.table.push_back(TableElement(INACTIVE,5,7));
-    fission.table.push_back(TableElement(INACTIVE,4,7));
-    fission.table.push_back(TableElement(ACTIVE,2,7));
-    fission.table.push_back(TableElement(ACTIVE,8,7));
-    fission.table.push_back(TableElement(ACTIVE,3,7));
-    fission.table.push_back(TableElement(INACTIVE,9,9));
-    fission.table.push_back(TableElement(INACTIVE,7,9));
-    fission.table.push_back(TableElement(INACTIVE,6,9));
-    fission.table.push_back(TableElement(INACTIVE,1,8));
-    fission.table.push_back(TableElement(INACTIVE,5,8));
-    fission.table.push_back(TableElement(INACTIVE,4,8));
-    fission.table.push_back(TableElement(ACTIVE,2,8));
-    fission.table.push_back(TableElement(ACTIVE,8,8));
-    fission.table.push_back(TableElement(ACTIVE,3,8));
-    fission.table.push_back(TableElement(INACTIVE,9,10));
-    fission.table.push_back(TableElement(INACTIVE,7,10));
-    fission.table.push_back(TableElement(INACTIVE,6,10));
-    fission.table.push_back(TableElement(INACTIVE,1,9));
-    fission.table.push_back(TableElement(INACTIVE,5,9));
-    fission.table.push_back(TableElement(INACTIVE,4,9));
-    fission.table.push_back(TableElement(ACTIVE,2,9));
-    fission.table.push_back(TableElement(ACTIVE,8,9));
-    fission.table.push_back(TableElement(ACTIVE,3,9));
-    fission.table.push_back(TableElement(INACTIVE,9,11));
-    fission.table.push_back(TableElement(INACTIVE,7,11));
-    fission.table.push_back(TableElement(INACTIVE,6,11));
-    fission.table.push_back(TableElement(INACTIVE,1,10));
-    fission.table.push_back(TableElement(INACTIVE,5,10));
-    fission.table.push_back(TableElement(INACTIVE,4,10));
-    fission.table.push_back(TableElement(ACTIVE,2,10));
-    fission.table.push_back(TableElement(ACTIVE,8,10));
-    fission.table.push_back(TableElement(ACTIVE,3,10));
-    fission.table.push_back(TableElement(INACTIVE,9,12));
-    fission.table.push_back(TableElement(INACTIVE,7,12));
-    fission.table.push_back(TableElement(INACTIVE,6,12));
-    fission.table.push_back(TableElement(INACTIVE,1,11));
-    fission.table.push_back(TableElement(INACTIVE,5,11));
-    fission.table.push_back(TableElement(INACTIVE,4,11));
-    fission.table.push_back(TableElement(ACTIVE,2,11));
-    fission.table.push_back(TableElement(ACTIVE,8,11));
-    fission.table.push_back(TableElement(ACTIVE,3,11));
-    fission.table.push_back(TableElement(INACTIVE,9,13));
-    fission.table.push_back(TableElement(INACTIVE,7,13));
-    fission.table.push_back(TableElement(INACTIVE,6,13));
-    fission.table.push_back(TableElement(INACTIVE,1,12));
-    fission.table.push_back(TableElement(INACTIVE,5,12));
-    fission.table.push_back(TableElement(INACTIVE,4,12));
-    fission.table.push_back(TableElement(ACTIVE,2,12));
-    fission.table.push_back(TableElement(ACTIVE,8,12));
-    fission.table.push_back(TableElement(ACTIVE,3,12));
-    fission.table.push_back(TableElement(INACTIVE,1,13));
-    fission.table.push_back(TableElement(INACTIVE,5,13));
-    fission.table.push_back(TableElement(INACTIVE,4,13));
-    fission.table.push_back(TableElement(ACTIVE,2,13));
-    fission.table.push_back(TableElement(ACTIVE,8,13));
-    fission.table.push_back(TableElement(ACTIVE,3,13));
-    
-    //safety check
-    size_t fissionTableSize = fission.geneNum * fission.timeSteps;
-    size_t fissionTableElementsNum = fission.table.size();
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
     
-    if(fissionTableSize != fissionTableElementsNum)
+    void Count(const char *counter, uint64_t value)
     {
-        std::cout << "\nERROR: missing entries in Fission timeseries table...\n\n";
-        return;
+        if(!active)
+            return;
+        
+        for(size_t i = 0; i < event.counters.size(); ++i)
+        {
+            if(strcmp(event.counters[i].first, counter) == 0)
+            {
+                event.counters[i].second += value;
+                return;
+            }
+        }
+        
+        event.counters.push_back(std::make_pair(counter, value));
     }
     
+    bool active;
+    TraceEvent event;
+};
+
+double SecondsSince(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// size of a file for the counters, 0 if it doesn't exist
+uint64_t TracedFileSize(const std::string &fileName)
+{
+    struct stat fileStat;
     
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    elegans.name = "elegans";
-    elegans.timeSteps = 7;
-    elegans.geneNum = 8;
-    elegans.diameter = 3; // learned from separate ASP program
+    return (stat(fileName.c_str(), &fileStat) == 0) ? (uint64_t)fileStat.st_size : 0;
+}
+
+void WriteJsonString(std::ostream &stream, const std::string &text)
+{
+    stream << '"';
     
-    if(Status == NOT_CORRUPTED)
+    for(size_t i = 0; i < text.size(); ++i)
     {
-        // Edges of original network
-        elegans.edges.push_back(Edge(ACTIVATES,1,7));
-        elegans.edges.push_back(Edge(INHIBITS,1,6));
-        elegans.edges.push_back(Edge(INHIBITS,1,3));
-        elegans.edges.push_back(Edge(INHIBITS,2,1));
-        elegans.edges.push_back(Edge(INHIBITS,2,2));
-        elegans.edges.push_back(Edge(INHIBITS,2,5));
-        elegans.edges.push_back(Edge(ACTIVATES,3,2));
-        elegans.edges.push_back(Edge(INHIBITS,3,5));
-        elegans.edges.push_back(Edge(ACTIVATES,3,4));
-        elegans.edges.push_back(Edge(ACTIVATES,4,2));
-        elegans.edges.push_back(Edge(INHIBITS,4,5));
-        elegans.edges.push_back(Edge(INHIBITS,4,4));
-        elegans.edges.push_back(Edge(ACTIVATES,5,3));
-        elegans.edges.push_back(Edge(ACTIVATES,6,5));
-        elegans.edges.push_back(Edge(INHIBITS,6,1));
-        elegans.edges.push_back(Edge(ACTIVATES,7,6));
-        elegans.edges.push_back(Edge(INHIBITS,7,1));
-        elegans.edges.push_back(Edge(INHIBITS,7,8));
-        elegans.edges.push_back(Edge(INHIBITS,7,7));
-        elegans.edges.push_back(Edge(ACTIVATES,8,5));
-        elegans.edges.push_back(Edge(ACTIVATES,8,1));
+        char character = text[i];
+        
+        if(character == '"' || character == '\\')
+            stream << '\\' << character;
+        else if((unsigned char)character < 0x20)
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)character << std::dec << std::setfill(' ');
+        else
+            stream << character;
     }
-    else if(Status == CORRUPTED)
+    
+    stream << '"';
+}
+
+// writes the events recorded so far (see chrome://tracing), and a total per phase to std::cout
+bool WriteTrace(const std::string &fileName)
+{
+    std::ofstream traceFile(fileName);
+    
+    if(!traceFile.is_open())
     {
-        elegans.edges.push_back(Edge(ACTIVATES,1,7));
-        elegans.edges.push_back(Edge(INHIBITS,1,6));
-        elegans.edges.push_back(Edge(INHIBITS,1,3));
-        //elegans.edges.push_back(Edge(INHIBITS,2,1));
-        elegans.edges.push_back(Edge(INHIBITS,2,2));
-        elegans.edges.push_back(Edge(INHIBITS,2,5));
-        elegans.edges.push_back(Edge(ACTIVATES,3,2));
-        //elegans.edges.push_back(Edge(INHIBITS,3,5));
-        elegans.edges.push_back(Edge(ACTIVATES,3,4));
-        elegans.edges.push_back(Edge(ACTIVATES,4,2));
-        elegans.edges.push_back(Edge(INHIBITS,4,5));
-        //elegans.edges.push_back(Edge(INHIBITS,4,4));
-        elegans.edges.push_back(Edge(ACTIVATES,5,3));
-        elegans.edges.push_back(Edge(ACTIVATES,6,5));
-        //elegans.edges.push_back(Edge(INHIBITS,6,1));
-        elegans.edges.push_back(Edge(ACTIVATES,7,6));
-        elegans.edges.push_back(Edge(INHIBITS,7,1));
-        //elegans.edges.push_back(Edge(INHIBITS,7,8));
-        elegans.edges.push_back(Edge(INHIBITS,7,7));
-        elegans.edges.push_back(Edge(ACTIVATES,8,5));
-        elegans.edges.push_back(Edge(ACTIVATES,8,1));
-        
-        elegans.addedEdges.push_back(Edge(ACTIVATES,3,7));
-        elegans.addedEdges.push_back(Edge(ACTIVATES,5,6));
-        elegans.addedEdges.push_back(Edge(ACTIVATES,7,2));
-        elegans.addedEdges.push_back(Edge(ACTIVATES,7,3));
-        elegans.addedEdges.push_back(Edge(ACTIVATES,7,5));
-        elegans.addedEdges.push_back(Edge(INHIBITS,1,8));
-        elegans.addedEdges.push_back(Edge(INHIBITS,2,3));
-        elegans.addedEdges.push_back(Edge(INHIBITS,2,8));
-        elegans.addedEdges.push_back(Edge(INHIBITS,3,1));
-        elegans.addedEdges.push_back(Edge(INHIBITS,3,8));
-        elegans.addedEdges.push_back(Edge(INHIBITS,4,8));
-        elegans.addedEdges.push_back(Edge(INHIBITS,5,1));
-        elegans.addedEdges.push_back(Edge(INHIBITS,5,5));
-        elegans.addedEdges.push_back(Edge(INHIBITS,5,7));
-        elegans.addedEdges.push_back(Edge(INHIBITS,5,8));
-        elegans.addedEdges.push_back(Edge(INHIBITS,6,8));
-        elegans.addedEdges.push_back(Edge(INHIBITS,7,4));
-        
+        std::cout << "ERROR: Unable to create trace file..\n";
+        return false;
     }
     
+    std::lock_guard<std::mutex> lock(tracer.mutex);
     
-    // Timeseries table
-    elegans.table.push_back(TableElement(ACTIVE,1,1));
-    elegans.table.push_back(TableElement(ACTIVE,2,1));
-    elegans.table.push_back(TableElement(ACTIVE,3,1));
-    elegans.table.push_back(TableElement(ACTIVE,4,1));
-    elegans.table.push_back(TableElement(ACTIVE,6,1));
-    elegans.table.push_back(TableElement(INACTIVE,5,1));
-    elegans.table.push_back(TableElement(INACTIVE,7,1));
-    elegans.table.push_back(TableElement(INACTIVE,8,1));
-    elegans.table.push_back(TableElement(ACTIVE,2,2));
-    elegans.table.push_back(TableElement(ACTIVE,4,2));
-    elegans.table.push_back(TableElement(INACTIVE,5,2));
-    elegans.table.push_back(TableElement(INACTIVE,8,2));
-    elegans.table.push_back(TableElement(ACTIVE,2,3));
-    elegans.table.push_back(TableElement(ACTIVE,6,3));
-    elegans.table.push_back(TableElement(INACTIVE,5,3));
-    elegans.table.push_back(TableElement(INACTIVE,7,3));
-    elegans.table.push_back(TableElement(INACTIVE,8,3));
-    elegans.table.push_back(TableElement(INACTIVE,1,2));
-    elegans.table.push_back(TableElement(INACTIVE,3,2));
-    elegans.table.push_back(TableElement(INACTIVE,6,2));
-    elegans.table.push_back(TableElement(ACTIVE,6,4));
-    elegans.table.push_back(TableElement(ACTIVE,7,2));
-    elegans.table.push_back(TableElement(INACTIVE,5,4));
-    elegans.table.push_back(TableElement(INACTIVE,7,4));
-    elegans.table.push_back(TableElement(INACTIVE,8,4));
-    elegans.table.push_back(TableElement(INACTIVE,1,3));
-    elegans.table.push_back(TableElement(INACTIVE,3,3));
-    elegans.table.push_back(TableElement(INACTIVE,4,3));
-    elegans.table.push_back(TableElement(ACTIVE,6,5));
-    elegans.table.push_back(TableElement(INACTIVE,7,5));
-    elegans.table.push_back(TableElement(INACTIVE,8,5));
-    elegans.table.push_back(TableElement(INACTIVE,1,4));
-    elegans.table.push_back(TableElement(INACTIVE,2,4));
-    elegans.table.push_back(TableElement(INACTIVE,3,4));
-    elegans.table.push_back(TableElement(INACTIVE,4,4));
-    elegans.table.push_back(TableElement(ACTIVE,3,6));
-    elegans.table.push_back(TableElement(ACTIVE,6,6));
-    elegans.table.push_back(TableElement(INACTIVE,7,6));
-    elegans.table.push_back(TableElement(INACTIVE,8,6));
-    elegans.table.push_back(TableElement(INACTIVE,1,5));
-    elegans.table.push_back(TableElement(INACTIVE,2,5));
-    elegans.table.push_back(TableElement(INACTIVE,3,5));
-    elegans.table.push_back(TableElement(INACTIVE,4,5));
-    elegans.table.push_back(TableElement(ACTIVE,2,7));
-    elegans.table.push_back(TableElement(ACTIVE,3,7));
-    elegans.table.push_back(TableElement(ACTIVE,4,7));
-    elegans.table.push_back(TableElement(ACTIVE,5,5));
-    elegans.table.push_back(TableElement(ACTIVE,6,7));
-    elegans.table.push_back(TableElement(INACTIVE,7,7));
-    elegans.table.push_back(TableElement(INACTIVE,8,7));
-    elegans.table.push_back(TableElement(INACTIVE,1,6));
-    elegans.table.push_back(TableElement(INACTIVE,2,6));
-    elegans.table.push_back(TableElement(INACTIVE,4,6));
-    elegans.table.push_back(TableElement(ACTIVE,5,6));
-    elegans.table.push_back(TableElement(INACTIVE,1,7));
-    elegans.table.push_back(TableElement(ACTIVE,5,7));
+    traceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
     
+    for(size_t i = 0; i < tracer.events.size(); ++i)
+    {
+        const TraceEvent &event = tracer.events[i];
+        
+        traceFile << "{\"name\":";
+        WriteJsonString(traceFile, event.name);
+        traceFile << ",\"cat\":\"repair\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread;
+        traceFile << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << ",\"args\":{";
+        
+        bool first = true;
+        
+        if(!event.detail.empty())
+        {
+            traceFile << "\"detail\":";
+            WriteJsonString(traceFile, event.detail);
+            first = false;
+        }
+        
+        for(size_t c = 0; c < event.counters.size(); ++c)
+        {
+            traceFile << (first ? "" : ",") << "\"" << event.counters[c].first << "\":" << event.counters[c].second;
+            first = false;
+        }
+        
+        traceFile << "}}" << (i + 1 < tracer.events.size() ? ",\n" : "\n");
+    }
     
+    traceFile << "]}\n";
     
-    //safety check
-    size_t elegansTableSize = elegans.geneNum * elegans.timeSteps;
-    size_t elegansTableElementsNum = elegans.table.size();
+    // (events of a phase nested in itself, e.g. recursive calls, would be counted twice)
+    std::vector<const char *> names;
+    std::vector<uint64_t> totals;
+    std::vector<size_t> calls;
     
-    if(elegansTableSize != elegansTableElementsNum)
+    for(size_t i = 0; i < tracer.events.size(); ++i)
     {
-        std::cout << "\nERROR: missing entries in Elegans timeseries table...\n\n";
-        return;
+        size_t n = 0;
+        
+        while(n < names.size() && strcmp(names[n], tracer.events[i].name) != 0)
+            ++n;
+        
+        if(n == names.size())
+        {
+            names.push_back(tracer.events[i].name);
+            totals.push_back(0);
+            calls.push_back(0);
+        }
+        
+        totals[n] += tracer.events[i].duration;
+        ++calls[n];
     }
     
+    std::cout << "\n\nTRACE (" << fileName << "):\n";
     
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    mammalian.name = "mammalian";
-    mammalian.timeSteps = 5;
-    mammalian.geneNum = 10;
-    mammalian.diameter = 3; // learned from separate ASP program
+    for(size_t n = 0; n < names.size(); ++n)
+        std::cout << "  " << names[n] << ": " << calls[n] << " calls, " << totals[n] / 1000.0 << " ms\n";
     
-    if(Status == NOT_CORRUPTED)
+    std::cout << "\n";
+    
+    return true;
+}
+
+struct GeneNetwork
+{
+    GeneNetwork()
     {
-        // Edges of original network
-        mammalian.edges.push_back(Edge(ACTIVATES,1,1));
-        mammalian.edges.push_back(Edge(INHIBITS,1,2));
-        mammalian.edges.push_back(Edge(INHIBITS,1,3));
-        mammalian.edges.push_back(Edge(INHIBITS,2,4));
-        mammalian.edges.push_back(Edge(INHIBITS,2,5));
-        mammalian.edges.push_back(Edge(INHIBITS,2,6));
-        mammalian.edges.push_back(Edge(ACTIVATES,3,3));
-        mammalian.edges.push_back(Edge(ACTIVATES,3,4));
-        mammalian.edges.push_back(Edge(ACTIVATES,3,5));
-        mammalian.edges.push_back(Edge(ACTIVATES,3,9));
-        mammalian.edges.push_back(Edge(ACTIVATES,3,2));
-        mammalian.edges.push_back(Edge(INHIBITS,4,3));
-        mammalian.edges.push_back(Edge(INHIBITS,4,4));
-        mammalian.edges.push_back(Edge(INHIBITS,4,2));
-        mammalian.edges.push_back(Edge(ACTIVATES,5,4));
-        mammalian.edges.push_back(Edge(ACTIVATES,5,6));
-        mammalian.edges.push_back(Edge(ACTIVATES,6,6));
-        mammalian.edges.push_back(Edge(INHIBITS,6,3));
-        mammalian.edges.push_back(Edge(INHIBITS,6,9));
-        mammalian.edges.push_back(Edge(ACTIVATES,6,8));
-        mammalian.edges.push_back(Edge(INHIBITS,6,2));
-        mammalian.edges.push_back(Edge(INHIBITS,6,5));
-        mammalian.edges.push_back(Edge(INHIBITS,6,4));
-        mammalian.edges.push_back(Edge(ACTIVATES,7,9));
-        mammalian.edges.push_back(Edge(INHIBITS,7,10));
-        mammalian.edges.push_back(Edge(ACTIVATES,7,8));
-        mammalian.edges.push_back(Edge(INHIBITS,7,6));
-        mammalian.edges.push_back(Edge(INHIBITS,8,6));
-        mammalian.edges.push_back(Edge(ACTIVATES,8,8));
-        mammalian.edges.push_back(Edge(INHIBITS,9,6));
-        mammalian.edges.push_back(Edge(INHIBITS,9,7));
-        mammalian.edges.push_back(Edge(INHIBITS,9,8));
-        mammalian.edges.push_back(Edge(INHIBITS,9,10));
-        mammalian.edges.push_back(Edge(ACTIVATES,10,7));
-        mammalian.edges.push_back(Edge(INHIBITS,10,9));
-        mammalian.edges.push_back(Edge(INHIBITS,10,3));
-        mammalian.edges.push_back(Edge(INHIBITS,10,2));
-        mammalian.edges.push_back(Edge(INHIBITS,10,5));
-        mammalian.edges.push_back(Edge(ACTIVATES,10,8));
+        timeSteps = 0;
+        geneNum = 0;
+        
+        kDegree = 0.0f;
+        edgesNodesRatio = 0.0f;
+        diameter = 0;
+        
+        adjacencyEdgesNum = 0;
+        adjacencyValid = false;
     }
-    else if(Status == CORRUPTED)
+    
+    GeneNetwork(GeneNetwork& rhs)
     {
-        mammalian.edges.push_back(Edge(ACTIVATES,1,1));
-        mammalian.edges.push_back(Edge(INHIBITS,1,2));
-        mammalian.edges.push_back(Edge(INHIBITS,1,3));
-        mammalian.edges.push_back(Edge(INHIBITS,2,4));
-        mammalian.edges.push_back(Edge(INHIBITS,2,5));
-        mammalian.edges.push_back(Edge(INHIBITS,2,6));
-        mammalian.edges.push_back(Edge(ACTIVATES,3,3));
-        //mammalian.edges.push_back(Edge(ACTIVATES,3,4));
-        //mammalian.edges.push_back(Edge(ACTIVATES,3,5));
-        //mammalian.edges.push_back(Edge(ACTIVATES,3,9));
-        mammalian.edges.push_back(Edge(ACTIVATES,3,2));
-        mammalian.edges.push_back(Edge(INHIBITS,4,3));
-        mammalian.edges.push_back(Edge(INHIBITS,4,4));
-        mammalian.edges.push_back(Edge(INHIBITS,4,2));
-        mammalian.edges.push_back(Edge(ACTIVATES,5,4));
-        mammalian.edges.push_back(Edge(ACTIVATES,5,6));
-        mammalian.edges.push_back(Edge(ACTIVATES,6,6));
-        mammalian.edges.push_back(Edge(INHIBITS,6,3));
-        mammalian.edges.push_back(Edge(INHIBITS,6,9));
-        mammalian.edges.push_back(Edge(ACTIVATES,6,8));
-        mammalian.edges.push_back(Edge(INHIBITS,6,2));
-        mammalian.edges.push_back(Edge(INHIBITS,6,5));
-        //mammalian.edges.push_back(Edge(INHIBITS,6,4));
-        mammalian.edges.push_back(Edge(ACTIVATES,7,9));
-        //mammalian.edges.push_back(Edge(INHIBITS,7,10));
-        mammalian.edges.push_back(Edge(ACTIVATES,7,8));
-        mammalian.edges.push_back(Edge(INHIBITS,7,6));
-        mammalian.edges.push_back(Edge(INHIBITS,8,6));
-        //mammalian.edges.push_back(Edge(ACTIVATES,8,8));
-        mammalian.edges.push_back(Edge(INHIBITS,9,6));
-        mammalian.edges.push_back(Edge(INHIBITS,9,7));
-        mammalian.edges.push_back(Edge(INHIBITS,9,8));
-        //mammalian.edges.push_back(Edge(INHIBITS,9,10));
-        mammalian.edges.push_back(Edge(ACTIVATES,10,7));
-        mammalian.edges.push_back(Edge(INHIBITS,10,9));
-        //mammalian.edges.push_back(Edge(INHIBITS,10,3));
-        mammalian.edges.push_back(Edge(INHIBITS,10,2));
-        mammalian.edges.push_back(Edge(INHIBITS,10,5));
-        mammalian.edges.push_back(Edge(ACTIVATES,10,8));
+        name = rhs.name;
         
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,5));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,6));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,7));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,8));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,9));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,10));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,2,1));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,3,8));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,4,5));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,4,8));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,4,9));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,5,8));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,7,3));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,7,5));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,8,3));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,8,4));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,9,3));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,10,1));
-        mammalian.addedEdges.push_back(Edge(ACTIVATES,10,4));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,2,7));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,2,8));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,2,9));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,2,10));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,3,1));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,4,6));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,5,7));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,6,1));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,6,7));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,6,10));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,7,2));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,8,10));
-        mammalian.addedEdges.push_back(Edge(INHIBITS,9,2));
+        timeSteps = rhs.timeSteps;
+        for(size_t i = 0; i < rhs.table.size(); ++i)
+            table.push_back(rhs.table[i]);
+        
+        geneNum = rhs.geneNum;
+        
+        for(size_t i = 0; i < rhs.edges.size(); ++i)
+            edges.push_back(rhs.edges[i]);
+        
+        for(size_t i = 0; i < rhs.addedEdges.size(); ++i)
+            addedEdges.push_back(rhs.addedEdges[i]);
+        
+        for(size_t i = 0; i < rhs.removedEdges.size(); ++i)
+            removedEdges.push_back(rhs.removedEdges[i]);
+        
+        kDegree = rhs.kDegree;
+        edgesNodesRatio = rhs.edgesNodesRatio;
+        diameter = rhs.diameter;
         
+        motifCounts = rhs.motifCounts;
         
+        // the copy builds its own index when it needs one
+        adjacencyEdgesNum = 0;
+        adjacencyValid = false;
     }
     
+    // back to an empty network, as after the default constructor
+    void Clear()
+    {
+        name.clear();
+        
+        timeSteps = 0;
+        table.clear();
+        
+        geneNum = 0;
+        edges.clear();
+        addedEdges.clear();
+        removedEdges.clear();
+        
+        kDegree = 0.0f;
+        edgesNodesRatio = 0.0f;
+        diameter = 0;
+        
+        motifCounts.clear();
+        
+        EdgesChanged();
+    }
     
-    // Timeseries table
-    mammalian.table.push_back(TableElement(INACTIVE,1,1));
-    mammalian.table.push_back(TableElement(INACTIVE,2,1));
-    mammalian.table.push_back(TableElement(INACTIVE,4,1));
-    mammalian.table.push_back(TableElement(INACTIVE,5,1));
-    mammalian.table.push_back(TableElement(INACTIVE,6,1));
-    mammalian.table.push_back(TableElement(INACTIVE,7,1));
-    mammalian.table.push_back(TableElement(INACTIVE,8,1));
-    mammalian.table.push_back(TableElement(INACTIVE,9,1));
-    mammalian.table.push_back(TableElement(ACTIVE,3,1));
-    mammalian.table.push_back(TableElement(ACTIVE,10,1));
-    mammalian.table.push_back(TableElement(ACTIVE,3,2));
-    mammalian.table.push_back(TableElement(ACTIVE,10,2));
-    mammalian.table.push_back(TableElement(INACTIVE,1,2));
-    mammalian.table.push_back(TableElement(INACTIVE,2,2));
-    mammalian.table.push_back(TableElement(INACTIVE,5,2));
-    mammalian.table.push_back(TableElement(INACTIVE,6,2));
-    mammalian.table.push_back(TableElement(INACTIVE,9,2));
-    mammalian.table.push_back(TableElement(ACTIVE,3,3));
-    mammalian.table.push_back(TableElement(INACTIVE,1,3));
-    mammalian.table.push_back(TableElement(INACTIVE,2,3));
-    mammalian.table.push_back(TableElement(INACTIVE,5,3));
-    mammalian.table.push_back(TableElement(INACTIVE,6,3));
-    mammalian.table.push_back(TableElement(INACTIVE,9,3));
-    mammalian.table.push_back(TableElement(ACTIVE,3,4));
-    mammalian.table.push_back(TableElement(ACTIVE,4,2));
-    mammalian.table.push_back(TableElement(ACTIVE,7,2));
-    mammalian.table.push_back(TableElement(ACTIVE,8,2));
-    mammalian.table.push_back(TableElement(INACTIVE,1,4));
-    mammalian.table.push_back(TableElement(INACTIVE,2,4));
-    mammalian.table.push_back(TableElement(INACTIVE,6,4));
-    mammalian.table.push_back(TableElement(ACTIVE,3,5));
-    mammalian.table.push_back(TableElement(ACTIVE,4,3));
-    mammalian.table.push_back(TableElement(ACTIVE,7,3));
-    mammalian.table.push_back(TableElement(ACTIVE,8,3));
-    mammalian.table.push_back(TableElement(INACTIVE,1,5));
-    mammalian.table.push_back(TableElement(INACTIVE,2,5));
-    mammalian.table.push_back(TableElement(INACTIVE,6,5));
-    mammalian.table.push_back(TableElement(INACTIVE,7,5));
-    mammalian.table.push_back(TableElement(ACTIVE,4,4));
-    mammalian.table.push_back(TableElement(ACTIVE,5,4));
-    mammalian.table.push_back(TableElement(ACTIVE,7,4));
-    mammalian.table.push_back(TableElement(ACTIVE,8,4));
-    mammalian.table.push_back(TableElement(ACTIVE,9,4));
-    mammalian.table.push_back(TableElement(INACTIVE,10,3));
-    mammalian.table.push_back(TableElement(ACTIVE,4,5));
-    mammalian.table.push_back(TableElement(ACTIVE,5,5));
-    mammalian.table.push_back(TableElement(ACTIVE,8,5));
-    mammalian.table.push_back(TableElement(ACTIVE,9,5));
-    mammalian.table.push_back(TableElement(INACTIVE,10,4));
-    mammalian.table.push_back(TableElement(INACTIVE,10,5));
-    
-    
+    // adjacency index of edges, built on first use and shared by LearnProperties' kDegree, diameter and motifs
+    // code that changes edges in place calls EdgesChanged() (a new number of edges or genes is noticed anyway)
+    const AdjacencyIndex &Adjacency()
+    {
+        if(!adjacencyValid || adjacency.geneNum != geneNum || adjacencyEdgesNum != edges.size())
+        {
+            adjacency.Build(geneNum, edges);
+            adjacencyEdgesNum = edges.size();
+            adjacencyValid = true;
+        }
+        
+        return adjacency;
+    }
     
+    void EdgesChanged()
+    {
+        adjacencyValid = false;
+    }
     
-    //safety check
-    size_t mammalianTableSize = mammalian.geneNum * mammalian.timeSteps;
-    size_t mammalianTableElementsNum = mammalian.table.size();
+    void LearnProperties()
+    {
+        if(edges.empty())
+        {
+            std::cout << "\nERROR: Network not loaded, can't learn properties...\n\n";
+            return;
+        }
+        
+        ScopedTimer timer("LearnProperties", name);
+        timer.Count("edges", edges.size());
+        
+        CalculateKDegree();
+        CalculateEdgesNodesRatio();
+        CalculateDiameter(geneNum > DIAMETER_EXACT_MAX_GENES);
+        CalculateMotifs();
+    }
     
-    if(mammalianTableSize != mammalianTableElementsNum)
+    void CalculateKDegree()
     {
-        std::cout << "\nERROR: missing entries in Mammalian timeseries table...\n\n";
-        return;
+        const AdjacencyIndex &adjacency = Adjacency();
+        
+        unsigned int kDegrees = 0;
+        
+        for(unsigned int i = 1; i <= geneNum; ++i)
+            kDegrees += adjacency.Degree(i);
+        
+        kDegree = (float)kDegrees / (float)geneNum;
     }
     
+    void CalculateEdgesNodesRatio()
+    {
+        edgesNodesRatio = (float)edges.size() / (float)geneNum;
+    }
     
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    arabidopsis.name = "arabidopsis";
-    arabidopsis.timeSteps = 5;
-    arabidopsis.geneNum = 10;
-    arabidopsis.diameter = 4; // learned from separate ASP program
+    void CalculateDiameter(bool approximate = false)
+    {
+        ScopedTimer timer("CalculateDiameter", name);
+        
+        diameter = ComputeDiameter(Adjacency(), approximate);
+    }
     
-    if(Status == NOT_CORRUPTED)
+    void CalculateMotifs()
     {
-        // Edges of original network
-        arabidopsis.edges.push_back(Edge(ACTIVATES,1,3));
-        arabidopsis.edges.push_back(Edge(INHIBITS,1,2));
-        arabidopsis.edges.push_back(Edge(INHIBITS,1,6));
-        arabidopsis.edges.push_back(Edge(INHIBITS,2,4));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,2,6));
-        arabidopsis.edges.push_back(Edge(INHIBITS,3,4));
-        arabidopsis.edges.push_back(Edge(INHIBITS,3,6));
-        arabidopsis.edges.push_back(Edge(INHIBITS,4,2));
-        arabidopsis.edges.push_back(Edge(INHIBITS,5,4));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,6,4));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,6,2));
-        arabidopsis.edges.push_back(Edge(INHIBITS,6,3));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,6,9));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,6,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,7,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,7,9));
-        arabidopsis.edges.push_back(Edge(INHIBITS,8,9));
-        arabidopsis.edges.push_back(Edge(INHIBITS,8,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,9,9));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,9,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,10,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,10,9));
+        ScopedTimer timer("CalculateMotifs", name);
+        
+        ComputeTriadCensus(Adjacency(), motifCounts);
     }
-    else if(Status == CORRUPTED)
+    
+    void PrintProperties()
     {
-        //arabidopsis.edges.push_back(Edge(ACTIVATES,1,3));
-        arabidopsis.edges.push_back(Edge(INHIBITS,1,2));
-        //arabidopsis.edges.push_back(Edge(INHIBITS,1,6));
-        arabidopsis.edges.push_back(Edge(INHIBITS,2,4));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,2,6));
-        arabidopsis.edges.push_back(Edge(INHIBITS,3,4));
-        arabidopsis.edges.push_back(Edge(INHIBITS,3,6));
-        arabidopsis.edges.push_back(Edge(INHIBITS,4,2));
-        arabidopsis.edges.push_back(Edge(INHIBITS,5,4));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,6,4));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,6,2));
-        arabidopsis.edges.push_back(Edge(INHIBITS,6,3));
-        //arabidopsis.edges.push_back(Edge(ACTIVATES,6,9));
-        //arabidopsis.edges.push_back(Edge(ACTIVATES,6,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,7,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,7,9));
-        arabidopsis.edges.push_back(Edge(INHIBITS,8,9));
-        arabidopsis.edges.push_back(Edge(INHIBITS,8,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,9,9));
-        //arabidopsis.edges.push_back(Edge(ACTIVATES,9,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,10,7));
-        arabidopsis.edges.push_back(Edge(ACTIVATES,10,9));
+        if(edges.empty())
+        {
+            std::cout << "\nERROR: Network not loaded, can't print properties...\n\n";
+            return;
+        }
         
-        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,1,7));
-        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,1,9));
-        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,4,3));
-        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,7,1));
-        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,10,6));
-        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,10,8));
-        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,10,10));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,2,8));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,2,9));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,2,10));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,3));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,5));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,6));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,7));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,8));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,10));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,6,6));
-        arabidopsis.addedEdges.push_back(Edge(INHIBITS,7,6));
+        std::cout << "\n\nNetwork: " << name << "\n";
+        std::cout << "\nNb. of nodes = " << geneNum << "\n";
+        std::cout << "\nNb. of edges = " << edges.size() << "\n";
+        std::cout << "\nEdges-Nodes Ratio = " << edgesNodesRatio << "\n";
+        std::cout << "\nAverage K degree of all nodes = " << kDegree << "\n";
+        std::cout << "\nDiameter = " << diameter << "\n";
         
+        if(!motifCounts.empty())
+        {
+            std::cout << "\n3-node motifs:";
+            
+            for(unsigned int motif = 1; motif < motifCounts.size(); ++motif)
+                std::cout << " " << motif << ":" << motifCounts[motif];
+            
+            std::cout << "\n\nDominant motifs (counted by rule of thumb 6) = " << CountDominantMotifs(motifCounts) << "\n";
+        }
         
+        std::cout << "\n\n";
     }
     
+    std::string name;
     
-    // Timeseries table
-    arabidopsis.table.push_back(TableElement(ACTIVE,1,1));
-    arabidopsis.table.push_back(TableElement(ACTIVE,6,1));
-    arabidopsis.table.push_back(TableElement(INACTIVE,2,1));
-    arabidopsis.table.push_back(TableElement(INACTIVE,3,1));
-    arabidopsis.table.push_back(TableElement(INACTIVE,4,1));
-    arabidopsis.table.push_back(TableElement(INACTIVE,5,1));
-    arabidopsis.table.push_back(TableElement(INACTIVE,7,1));
-    arabidopsis.table.push_back(TableElement(INACTIVE,8,1));
-    arabidopsis.table.push_back(TableElement(INACTIVE,9,1));
-    arabidopsis.table.push_back(TableElement(INACTIVE,10,1));
-    arabidopsis.table.push_back(TableElement(ACTIVE,1,2));
-    arabidopsis.table.push_back(TableElement(INACTIVE,2,2));
-    arabidopsis.table.push_back(TableElement(INACTIVE,3,2));
-    arabidopsis.table.push_back(TableElement(INACTIVE,5,2));
-    arabidopsis.table.push_back(TableElement(INACTIVE,8,2));
-    arabidopsis.table.push_back(TableElement(INACTIVE,10,2));
-    arabidopsis.table.push_back(TableElement(ACTIVE,1,3));
-    arabidopsis.table.push_back(TableElement(INACTIVE,2,3));
-    arabidopsis.table.push_back(TableElement(INACTIVE,5,3));
-    arabidopsis.table.push_back(TableElement(INACTIVE,8,3));
-    arabidopsis.table.push_back(TableElement(INACTIVE,10,3));
-    arabidopsis.table.push_back(TableElement(INACTIVE,6,2));
-    arabidopsis.table.push_back(TableElement(ACTIVE,1,4));
-    arabidopsis.table.push_back(TableElement(ACTIVE,4,2));
-    arabidopsis.table.push_back(TableElement(ACTIVE,7,2));
-    arabidopsis.table.push_back(TableElement(ACTIVE,9,2));
-    arabidopsis.table.push_back(TableElement(INACTIVE,2,4));
-    arabidopsis.table.push_back(TableElement(INACTIVE,4,4));
-    arabidopsis.table.push_back(TableElement(INACTIVE,5,4));
-    arabidopsis.table.push_back(TableElement(INACTIVE,8,4));
-    arabidopsis.table.push_back(TableElement(INACTIVE,10,4));
-    arabidopsis.table.push_back(TableElement(INACTIVE,6,3));
-    arabidopsis.table.push_back(TableElement(ACTIVE,1,5));
-    arabidopsis.table.push_back(TableElement(ACTIVE,4,3));
-    arabidopsis.table.push_back(TableElement(ACTIVE,7,3));
-    arabidopsis.table.push_back(TableElement(ACTIVE,9,3));
-    arabidopsis.table.push_back(TableElement(ACTIVE,3,3));
-    arabidopsis.table.push_back(TableElement(INACTIVE,2,5));
-    arabidopsis.table.push_back(TableElement(INACTIVE,4,5));
-    arabidopsis.table.push_back(TableElement(INACTIVE,5,5));
-    arabidopsis.table.push_back(TableElement(INACTIVE,8,5));
-    arabidopsis.table.push_back(TableElement(INACTIVE,10,5));
-    arabidopsis.table.push_back(TableElement(INACTIVE,6,4));
-    arabidopsis.table.push_back(TableElement(ACTIVE,3,4));
-    arabidopsis.table.push_back(TableElement(ACTIVE,7,4));
-    arabidopsis.table.push_back(TableElement(ACTIVE,9,4));
-    arabidopsis.table.push_back(TableElement(INACTIVE,6,5));
-    arabidopsis.table.push_back(TableElement(ACTIVE,3,5));
-    arabidopsis.table.push_back(TableElement(ACTIVE,7,5));
-    arabidopsis.table.push_back(TableElement(ACTIVE,9,5));
+    unsigned int timeSteps;
+    std::vector<TableElement> table;
     
+    unsigned int geneNum;
+    std::vector<Edge> edges;
+    std::vector<Edge> addedEdges; // edges added to corrupt the network
+    std::vector<Edge> removedEdges; // edges of the original network removed to corrupt it (only known for generated corruptions)
     
+    float kDegree; // average of number of total edges connected to a node
+    float edgesNodesRatio; // ratio of edges per node
+    unsigned int diameter; // diameter of the network (largest value of smallest distances between every pair of nodes)
     
-    //safety check
-    size_t arabidopsisTableSize = arabidopsis.geneNum * arabidopsis.timeSteps;
-    size_t arabidopsisTableElementsNum = arabidopsis.table.size();
+    std::vector<uint64_t> motifCounts; // number of (X,Y,Z) triples of each motif3 class of rule of thumb 6
     
-    if(arabidopsisTableSize != arabidopsisTableElementsNum)
+    AdjacencyIndex adjacency; // see Adjacency()
+    size_t adjacencyEdgesNum;
+    bool adjacencyValid;
+};
+
+
+
+
+// largest number of repairCost rules read from answer sets
+const unsigned int MAX_REPAIR_RULES = 1024;
+
+// repairCost(0,_) to repairCost(6,_) of CreateASPfile (the repair itself and the 6 rules of thumb)
+const unsigned int ASP_FILE_REPAIR_RULES = 7;
+
+// repairs given to the kernels at once (small enough for exact 64-bit sums of squared costs below 2^26)
+const size_t REPAIR_TABLE_CHUNK = 4096;
+
+// repair costs stored column per rule (columns[rule][repair]), so every kernel runs over contiguous arrays
+// a rule missing from a repair costs 0, and adding a rule is just one more column
+struct RepairCostTable
+{
+    RepairCostTable()
     {
-        std::cout << "\nERROR: missing entries in Arabidopsis timeseries table...\n\n";
-        return;
+        repairsNum = 0;
     }
     
+    // keeps the columns (and their memory), drops the repairs
+    void Clear()
+    {
+        for(size_t rule = 0; rule < columns.size(); ++rule)
+            columns[rule].clear();
+        
+        repairsNum = 0;
+    }
     
+    void Add(const std::vector<unsigned int> &costs)
+    {
+        if(costs.size() > columns.size())
+            columns.resize(costs.size(), std::vector<unsigned int>(repairsNum, 0));
+        
+        for(size_t rule = 0; rule < columns.size(); ++rule)
+            columns[rule].push_back((rule < costs.size()) ? costs[rule] : 0);
+        
+        ++repairsNum;
+    }
     
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    //***********************************************************************************************************************************
-    thcell.name = "thcell";
-    thcell.timeSteps = 10;
-    thcell.geneNum = 51;
+    size_t RulesNum() const
+    {
+        return columns.size();
+    }
     
+    std::vector<std::vector<unsigned int>> columns;
+    size_t repairsNum;
+};
+
+
+// running mean and variance of the rule costs of a stream of repairs (Welford), in double precision
+// two of them (other threads, other files) merge into the statistics of both streams together (Chan et al.)
+struct RuleStatistics
+{
+    RuleStatistics()
+    {
+        count = 0;
+    }
     
-    // Edges of original network
-    //IRF4 		1
-    //IL13 		2
-    //NFAT 		3
-    //MAF 		4
-    //GATA3 	5
-    //IL5		6
-    //IFNGR		7
-    //TBET		8
-    //STAT1		9
-    //IL7R		10
-    //IFNG		11
-    //STAT4		12
-    //IRAK		13
-    //STAT6		14
-    //IL7		15
-    //IL18		16
-    //IL4R		17
-    //IFNAR1	18
-    //IFNA		19
-    //IL4		20
-    //SOCS1		21
-    //CD80		22
-    //CTLA4		23
-    //SHP1		24
-    //CD45		25
-    //LCK		26
-    //CD4		27
-    //TCR		28
-    //ZAP70		29
-    //CD3		30
-    //SLP76		31
-    //VAV1		32
-    //CD28		33
-    //ITK		34
-    //PLCPG		35
-    //ANTIGEN	36
-    //TNFSF4	37
-    //TNFRSF4	38
-    //NFKB		39
-    //IKBKB		40
-    //PI3K		41
-    //ICOS		42
-    //AKT1		43
-    //COT		44
-    //NIK		45
-    //CD86		46
-    //JAK1		47
-    //JAK3		48
-    //IL12R		49
-    //IL12		50
-    //IL18R		51
+    // a rule seen for the first time had cost 0 in every repair before, which is mean 0 and m2 0
+    void AddRules(size_t rulesNum)
+    {
+        if(rulesNum > means.size())
+        {
+            means.resize(rulesNum, 0.0);
+            m2.resize(rulesNum, 0.0);
+        }
+    }
     
-    thcell.edges.push_back(Edge(ACTIVATES,1,2));
-    thcell.edges.push_back(Edge(ACTIVATES,3,2));
-    thcell.edges.push_back(Edge(ACTIVATES,4,2));
-    thcell.edges.push_back(Edge(ACTIVATES,5,2));
-    thcell.edges.push_back(Edge(ACTIVATES,1,6));
-    thcell.edges.push_back(Edge(ACTIVATES,3,6));
-    thcell.edges.push_back(Edge(ACTIVATES,4,6));
-    thcell.edges.push_back(Edge(ACTIVATES,5,6));
-    thcell.edges.push_back(Edge(ACTIVATES,7,8));
-    thcell.edges.push_back(Edge(INHIBITS,5,8));
-    thcell.edges.push_back(Edge(ACTIVATES,9,8));
-    thcell.edges.push_back(Edge(ACTIVATES,10,11));
-    thcell.edges.push_back(Edge(ACTIVATES,8,11));
-    thcell.edges.push_back(Edge(ACTIVATES,12,11));
-    thcell.edges.push_back(Edge(ACTIVATES,9,11));
-    thcell.edges.push_back(Edge(ACTIVATES,13,11));
-    thcell.edges.push_back(Edge(ACTIVATES,14,4));
-    thcell.edges.push_back(Edge(ACTIVATES,14,5));
-    thcell.edges.push_back(Edge(INHIBITS,8,5));
-    thcell.edges.push_back(Edge(ACTIVATES,15,10));
-    thcell.edges.push_back(Edge(ACTIVATES,16,51));
-    thcell.edges.push_back(Edge(INHIBITS,17,51));
-    thcell.edges.push_back(Edge(ACTIVATES,51,13));
-    thcell.edges.push_back(Edge(ACTIVATES,18,9));
-    thcell.edges.push_back(Edge(ACTIVATES,7,9));
-    thcell.edges.push_back(Edge(ACTIVATES,19,18));
-    thcell.edges.push_back(Edge(ACTIVATES,11,7));
-    thcell.edges.push_back(Edge(ACTIVATES,20,17));
-    thcell.edges.push_back(Edge(INHIBITS,21,17));
-    thcell.edges.push_back(Edge(ACTIVATES,1,20));
-    thcell.edges.push_back(Edge(ACTIVATES,3,20));
-    thcell.edges.push_back(Edge(ACTIVATES,4,20));
-    thcell.edges.push_back(Edge(ACTIVATES,5,20));
-    thcell.edges.push_back(Edge(ACTIVATES,22,23));
-    thcell.edges.push_back(Edge(ACTIVATES,23,24));
-    thcell.edges.push_back(Edge(ACTIVATES,25,26));
-    thcell.edges.push_back(Edge(ACTIVATES,27,26));
-    thcell.edges.push_back(Edge(ACTIVATES,28,29));
-    thcell.edges.push_back(Edge(ACTIVATES,30,29));
-    thcell.edges.push_back(Edge(INHIBITS,24,29));
-    thcell.edges.push_back(Edge(ACTIVATES,26,29));
-    thcell.edges.push_back(Edge(ACTIVATES,29,31));
-    thcell.edges.push_back(Edge(ACTIVATES,26,32));
-    thcell.edges.push_back(Edge(ACTIVATES,33,34));
-    thcell.edges.push_back(Edge(ACTIVATES,32,34));
-    thcell.edges.push_back(Edge(ACTIVATES,31,34));
-    thcell.edges.push_back(Edge(ACTIVATES,34,35));
-    thcell.edges.push_back(Edge(ACTIVATES,36,27));
-    thcell.edges.push_back(Edge(ACTIVATES,36,28));
-    thcell.edges.push_back(Edge(ACTIVATES,36,30));
-    thcell.edges.push_back(Edge(ACTIVATES,36,25));
-    thcell.edges.push_back(Edge(ACTIVATES,37,38));
-    thcell.edges.push_back(Edge(INHIBITS,7,39));
-    thcell.edges.push_back(Edge(ACTIVATES,38,39));
-    thcell.edges.push_back(Edge(ACTIVATES,40,39));
-    thcell.edges.push_back(Edge(ACTIVATES,14,1));
-    thcell.edges.push_back(Edge(ACTIVATES,39,1));
-    thcell.edges.push_back(Edge(ACTIVATES,33,3));
-    thcell.edges.push_back(Edge(ACTIVATES,38,3));
-    thcell.edges.push_back(Edge(ACTIVATES,35,3));
-    thcell.edges.push_back(Edge(ACTIVATES,1,3));
-    thcell.edges.push_back(Edge(ACTIVATES,33,41));
-    thcell.edges.push_back(Edge(ACTIVATES,42,41));
-    thcell.edges.push_back(Edge(ACTIVATES,41,43));
-    thcell.edges.push_back(Edge(ACTIVATES,43,44));
-    thcell.edges.push_back(Edge(ACTIVATES,44,45));
-    thcell.edges.push_back(Edge(ACTIVATES,45,40));
-    thcell.edges.push_back(Edge(ACTIVATES,46,33));
-    thcell.edges.push_back(Edge(ACTIVATES,17,47));
-    thcell.edges.push_back(Edge(INHIBITS,24,47));
-    thcell.edges.push_back(Edge(INHIBITS,21,47));
-    thcell.edges.push_back(Edge(ACTIVATES,17,48));
-    thcell.edges.push_back(Edge(ACTIVATES,18,14));
-    thcell.edges.push_back(Edge(ACTIVATES,47,14));
-    thcell.edges.push_back(Edge(ACTIVATES,48,14));
-    thcell.edges.push_back(Edge(ACTIVATES,49,12));
-    thcell.edges.push_back(Edge(ACTIVATES,18,12));
-    thcell.edges.push_back(Edge(INHIBITS,14,12));
-    thcell.edges.push_back(Edge(ACTIVATES,7,21));
-    thcell.edges.push_back(Edge(ACTIVATES,9,21));
-    thcell.edges.push_back(Edge(ACTIVATES,8,21));
-    thcell.edges.push_back(Edge(ACTIVATES,50,49));
-    thcell.edges.push_back(Edge(ACTIVATES,37,42));
+    void Add(const std::vector<unsigned int> &ruleViolations)
+    {
+        AddRules(ruleViolations.size());
+        
+        ++count;
+        
+        for(size_t i = 0; i < means.size(); ++i)
+        {
+            double value = (i < ruleViolations.size()) ? (double)ruleViolations[i] : 0.0;
+            double delta = value - means[i];
+            
+            means[i] += delta / (double)count;
+            m2[i] += delta * (value - means[i]);
+        }
+    }
     
+    // adds a whole table: exact integer sums per column (these loops vectorize), then merged like another stream
+    void AddTable(const RepairCostTable &table)
+    {
+        if(table.repairsNum == 0)
+            return;
+        
+        RuleStatistics tableStatistics;
+        
+        tableStatistics.count = table.repairsNum;
+        tableStatistics.AddRules(table.RulesNum());
+        
+        for(size_t rule = 0; rule < table.RulesNum(); ++rule)
+        {
+            const unsigned int *column = table.columns[rule].data();
+            
+            uint64_t sum = 0;
+            uint64_t sumOfSquares = 0;
+            
+            for(size_t i = 0; i < table.repairsNum; ++i)
+            {
+                sum += column[i];
+                sumOfSquares += (uint64_t)column[i] * column[i];
+            }
+            
+            // n * m2 = n * sum(x^2) - sum(x)^2, exact in 128 bits
+            unsigned __int128 nTimesM2 = (unsigned __int128)table.repairsNum * sumOfSquares - (unsigned __int128)sum * sum;
+            
+            tableStatistics.means[rule] = (double)sum / (double)table.repairsNum;
+            tableStatistics.m2[rule] = (double)nTimesM2 / (double)table.repairsNum;
+        }
+        
+        Merge(tableStatistics);
+    }
     
+    void Merge(const RuleStatistics &other)
+    {
+        if(other.count == 0)
+            return;
+        
+        AddRules(other.RulesNum());
+        
+        uint64_t totalCount = count + other.count;
+        
+        for(size_t i = 0; i < means.size(); ++i)
+        {
+            double otherMean = (i < other.means.size()) ? other.means[i] : 0.0;
+            double otherM2 = (i < other.m2.size()) ? other.m2[i] : 0.0;
+            
+            double delta = otherMean - means[i];
+            
+            means[i] += delta * ((double)other.count / (double)totalCount);
+            m2[i] += otherM2 + delta * delta * ((double)count * (double)other.count / (double)totalCount);
+        }
+        
+        count = totalCount;
+    }
     
+    size_t RulesNum() const
+    {
+        return means.size();
+    }
     
-    // Added edges to corrupt the network
-    thcell.addedEdges.push_back(Edge(INHIBITS,6,19));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,11,49));
-    thcell.addedEdges.push_back(Edge(INHIBITS,20,34));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,41,17));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,39,26));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,23,14));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,43,39));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,34,44));
-    thcell.addedEdges.push_back(Edge(INHIBITS,13,27));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,45,20));
-    thcell.addedEdges.push_back(Edge(INHIBITS,7,43));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,42,12));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,20,38));
-    thcell.addedEdges.push_back(Edge(INHIBITS,17,49));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,12,48));
-    thcell.addedEdges.push_back(Edge(INHIBITS,48,42));
-    thcell.addedEdges.push_back(Edge(INHIBITS,5,19));
-    thcell.addedEdges.push_back(Edge(INHIBITS,50,36));
-    thcell.addedEdges.push_back(Edge(INHIBITS,40,51));
-    thcell.addedEdges.push_back(Edge(ACTIVATES,5,3));
+    // sample variance, like the two-pass version it replaces
+    double Variance(size_t rule) const
+    {
+        return (count > 1) ? m2[rule] / (double)(count - 1) : 0.0;
+    }
     
+    double StandardDeviation(size_t rule) const
+    {
+        return sqrt(Variance(rule));
+    }
     
+    uint64_t count;
     
+    std::vector<double> means;
+    std::vector<double> m2; // sum of squared differences from the mean
+};
+
+// total z-score of every repair of the table: sum over rules of (cost - mean) / standard deviation
+// rules that are the same in every repair (standard deviation 0) don't count
+// one pass per column, each a multiply-add over contiguous arrays that the compiler vectorizes
+void ComputeTotalZScores(const RepairCostTable &table, const RuleStatistics &statistics, std::vector<double> &totalZScores)
+{
+    totalZScores.assign(table.repairsNum, 0.0);
     
-    // Timeseries table
-    thcell.table.push_back(TableElement(INACTIVE,1,1));
-    thcell.table.push_back(TableElement(INACTIVE,2,1));
-    thcell.table.push_back(TableElement(INACTIVE,3,1));
-    thcell.table.push_back(TableElement(INACTIVE,4,1));
-    thcell.table.push_back(TableElement(INACTIVE,5,1));
-    thcell.table.push_back(TableElement(INACTIVE,6,1));
-    thcell.table.push_back(TableElement(INACTIVE,7,1));
-    thcell.table.push_back(TableElement(INACTIVE,8,1));
-    thcell.table.push_back(TableElement(INACTIVE,9,1));
-    thcell.table.push_back(TableElement(INACTIVE,10,1));
-    thcell.table.push_back(TableElement(INACTIVE,11,1));
-    thcell.table.push_back(TableElement(INACTIVE,12,1));
-    thcell.table.push_back(TableElement(INACTIVE,13,1));
-    thcell.table.push_back(TableElement(INACTIVE,14,1));
-    thcell.table.push_back(TableElement(INACTIVE,17,1));
-    thcell.table.push_back(TableElement(INACTIVE,18,1));
-    thcell.table.push_back(TableElement(INACTIVE,20,1));
-    thcell.table.push_back(TableElement(INACTIVE,21,1));
-    thcell.table.push_back(TableElement(INACTIVE,23,1));
-    thcell.table.push_back(TableElement(INACTIVE,24,1));
-    thcell.table.push_back(TableElement(INACTIVE,25,1));
-    thcell.table.push_back(TableElement(INACTIVE,26,1));
-    thcell.table.push_back(TableElement(INACTIVE,27,1));
-    thcell.table.push_back(TableElement(INACTIVE,28,1));
-    thcell.table.push_back(TableElement(INACTIVE,29,1));
-    thcell.table.push_back(TableElement(INACTIVE,30,1));
-    thcell.table.push_back(TableElement(INACTIVE,31,1));
-    thcell.table.push_back(TableElement(INACTIVE,32,1));
-    thcell.table.push_back(TableElement(INACTIVE,33,1));
-    thcell.table.push_back(TableElement(INACTIVE,34,1));
-    thcell.table.push_back(TableElement(INACTIVE,35,1));
-    thcell.table.push_back(TableElement(INACTIVE,38,1));
-    thcell.table.push_back(TableElement(INACTIVE,39,1));
-    thcell.table.push_back(TableElement(INACTIVE,40,1));
-    thcell.table.push_back(TableElement(INACTIVE,41,1));
-    thcell.table.push_back(TableElement(INACTIVE,42,1));
-    thcell.table.push_back(TableElement(INACTIVE,43,1));
-    thcell.table.push_back(TableElement(INACTIVE,44,1));
-    thcell.table.push_back(TableElement(INACTIVE,45,1));
-    thcell.table.push_back(TableElement(INACTIVE,47,1));
-    thcell.table.push_back(TableElement(INACTIVE,48,1));
-    thcell.table.push_back(TableElement(INACTIVE,49,1));
-    thcell.table.push_back(TableElement(INACTIVE,51,1));
-    thcell.table.push_back(TableElement(ACTIVE,15,1));
-    thcell.table.push_back(TableElement(ACTIVE,16,1));
-    thcell.table.push_back(TableElement(ACTIVE,19,1));
-    thcell.table.push_back(TableElement(ACTIVE,22,1));
-    thcell.table.push_back(TableElement(ACTIVE,36,1));
-    thcell.table.push_back(TableElement(ACTIVE,37,1));
-    thcell.table.push_back(TableElement(ACTIVE,46,1));
-    thcell.table.push_back(TableElement(ACTIVE,50,1));
-    thcell.table.push_back(TableElement(ACTIVE,15,2));
-    thcell.table.push_back(TableElement(ACTIVE,16,2));
-    thcell.table.push_back(TableElement(ACTIVE,19,2));
-    thcell.table.push_back(TableElement(ACTIVE,22,2));
-    thcell.table.push_back(TableElement(ACTIVE,36,2));
-    thcell.table.push_back(TableElement(ACTIVE,37,2));
-    thcell.table.push_back(TableElement(ACTIVE,46,2));
-    thcell.table.push_back(TableElement(ACTIVE,50,2));
-    thcell.table.push_back(TableElement(INACTIVE,1,2));
-    thcell.table.push_back(TableElement(INACTIVE,2,2));
-    thcell.table.push_back(TableElement(INACTIVE,3,2));
-    thcell.table.push_back(TableElement(INACTIVE,4,2));
-    thcell.table.push_back(TableElement(INACTIVE,5,2));
-    thcell.table.push_back(TableElement(INACTIVE,6,2));
-    thcell.table.push_back(TableElement(INACTIVE,7,2));
-    thcell.table.push_back(TableElement(INACTIVE,8,2));
-    thcell.table.push_back(TableElement(INACTIVE,9,2));
-    thcell.table.push_back(TableElement(INACTIVE,11,2));
-    thcell.table.push_back(TableElement(INACTIVE,12,2));
-    thcell.table.push_back(TableElement(INACTIVE,13,2));
-    thcell.table.push_back(TableElement(INACTIVE,14,2));
-    thcell.table.push_back(TableElement(INACTIVE,17,2));
-    thcell.table.push_back(TableElement(INACTIVE,20,2));
-    thcell.table.push_back(TableElement(INACTIVE,21,2));
-    thcell.table.push_back(TableElement(INACTIVE,24,2));
-    thcell.table.push_back(TableElement(INACTIVE,26,2));
-    thcell.table.push_back(TableElement(INACTIVE,29,2));
-    thcell.table.push_back(TableElement(INACTIVE,31,2));
-    thcell.table.push_back(TableElement(INACTIVE,32,2));
-    thcell.table.push_back(TableElement(INACTIVE,34,2));
-    thcell.table.push_back(TableElement(INACTIVE,35,2));
-    thcell.table.push_back(TableElement(INACTIVE,39,2));
-    thcell.table.push_back(TableElement(INACTIVE,40,2));
-    thcell.table.push_back(TableElement(INACTIVE,41,2));
-    thcell.table.push_back(TableElement(INACTIVE,43,2));
-    thcell.table.push_back(TableElement(INACTIVE,44,2));
-    thcell.table.push_back(TableElement(INACTIVE,45,2));
-    thcell.table.push_back(TableElement(INACTIVE,47,2));
-    thcell.table.push_back(TableElement(INACTIVE,48,2));
-    thcell.table.push_back(TableElement(ACTIVE,15,3));
-    thcell.table.push_back(TableElement(ACTIVE,16,3));
-    thcell.table.push_back(TableElement(ACTIVE,19,3));
-    thcell.table.push_back(TableElement(ACTIVE,22,3));
-    thcell.table.push_back(TableElement(ACTIVE,36,3));
-    thcell.table.push_back(TableElement(ACTIVE,37,3));
-    thcell.table.push_back(TableElement(ACTIVE,46,3));
-    thcell.table.push_back(TableElement(ACTIVE,50,3));
-    thcell.table.push_back(TableElement(INACTIVE,1,3));
-    thcell.table.push_back(TableElement(INACTIVE,2,3));
-    thcell.table.push_back(TableElement(INACTIVE,4,3));
-    thcell.table.push_back(TableElement(INACTIVE,5,3));
-    thcell.table.push_back(TableElement(INACTIVE,6,3));
-    thcell.table.push_back(TableElement(INACTIVE,7,3));
-    thcell.table.push_back(TableElement(INACTIVE,8,3));
-    thcell.table.push_back(TableElement(INACTIVE,17,3));
-    thcell.table.push_back(TableElement(INACTIVE,20,3));
-    thcell.table.push_back(TableElement(INACTIVE,21,3));
-    thcell.table.push_back(TableElement(INACTIVE,31,3));
-    thcell.table.push_back(TableElement(INACTIVE,32,3));
-    thcell.table.push_back(TableElement(INACTIVE,35,3));
-    thcell.table.push_back(TableElement(INACTIVE,40,3));
-    thcell.table.push_back(TableElement(INACTIVE,43,3));
-    thcell.table.push_back(TableElement(INACTIVE,44,3));
-    thcell.table.push_back(TableElement(INACTIVE,45,3));
-    thcell.table.push_back(TableElement(INACTIVE,47,3));
-    thcell.table.push_back(TableElement(INACTIVE,48,3));
-    thcell.table.push_back(TableElement(ACTIVE,15,4));
-    thcell.table.push_back(TableElement(ACTIVE,16,4));
-    thcell.table.push_back(TableElement(ACTIVE,19,4));
-    thcell.table.push_back(TableElement(ACTIVE,22,4));
-    thcell.table.push_back(TableElement(ACTIVE,36,4));
-    thcell.table.push_back(TableElement(ACTIVE,37,4));
-    thcell.table.push_back(TableElement(ACTIVE,46,4));
-    thcell.table.push_back(TableElement(ACTIVE,50,4));
-    thcell.table.push_back(TableElement(ACTIVE,10,2));
-    thcell.table.push_back(TableElement(ACTIVE,18,2));
-    thcell.table.push_back(TableElement(ACTIVE,23,2));
-    thcell.table.push_back(TableElement(ACTIVE,25,2));
-    thcell.table.push_back(TableElement(ACTIVE,27,2));
-    thcell.table.push_back(TableElement(ACTIVE,28,2));
-    thcell.table.push_back(TableElement(ACTIVE,30,2));
-    thcell.table.push_back(TableElement(ACTIVE,33,2));
-    thcell.table.push_back(TableElement(ACTIVE,38,2));
-    thcell.table.push_back(TableElement(ACTIVE,42,2));
-    thcell.table.push_back(TableElement(ACTIVE,49,2));
-    thcell.table.push_back(TableElement(ACTIVE,51,2));
-    thcell.table.push_back(TableElement(INACTIVE,17,4));
-    thcell.table.push_back(TableElement(INACTIVE,40,4));
-    thcell.table.push_back(TableElement(INACTIVE,44,4));
-    thcell.table.push_back(TableElement(INACTIVE,45,4));
-    thcell.table.push_back(TableElement(INACTIVE,47,4));
-    thcell.table.push_back(TableElement(INACTIVE,48,4));
-    thcell.table.push_back(TableElement(ACTIVE,10,3));
-    thcell.table.push_back(TableElement(ACTIVE,15,5));
-    thcell.table.push_back(TableElement(ACTIVE,16,5));
-    thcell.table.push_back(TableElement(ACTIVE,18,3));
-    thcell.table.push_back(TableElement(ACTIVE,19,5));
-    thcell.table.push_back(TableElement(ACTIVE,22,5));
-    thcell.table.push_back(TableElement(ACTIVE,23,3));
-    thcell.table.push_back(TableElement(ACTIVE,25,3));
-    thcell.table.push_back(TableElement(ACTIVE,27,3));
-    thcell.table.push_back(TableElement(ACTIVE,28,3));
-    thcell.table.push_back(TableElement(ACTIVE,30,3));
-    thcell.table.push_back(TableElement(ACTIVE,33,3));
-    thcell.table.push_back(TableElement(ACTIVE,36,5));
-    thcell.table.push_back(TableElement(ACTIVE,37,5));
-    thcell.table.push_back(TableElement(ACTIVE,38,3));
-    thcell.table.push_back(TableElement(ACTIVE,42,3));
-    thcell.table.push_back(TableElement(ACTIVE,46,5));
-    thcell.table.push_back(TableElement(ACTIVE,49,3));
-    thcell.table.push_back(TableElement(ACTIVE,50,5));
-    thcell.table.push_back(TableElement(ACTIVE,51,3));
-    thcell.table.push_back(TableElement(INACTIVE,17,5));
-    thcell.table.push_back(TableElement(INACTIVE,40,5));
+    double *totals = totalZScores.data();
+    
+    for(size_t rule = 0; rule < table.RulesNum() && rule < statistics.RulesNum(); ++rule)
+    {
+        double standardDeviation = statistics.StandardDeviation(rule);
+        
+        if(standardDeviation <= 0.000001)
+            continue;
+        
+        double scale = 1.0 / standardDeviation;
+        double offset = statistics.means[rule] * scale;
+        
+        const unsigned int *column = table.columns[rule].data();
+        
+        for(size_t i = 0; i < table.repairsNum; ++i)
+            totals[i] += (double)column[i] * scale - offset;
+    }
+}
+
+// true if repair a is at least as good as b on every rule and better on one (costs are minimized)
+inline bool Dominates(const unsigned int *a, const unsigned int *b, size_t rulesNum)
+{
+    bool better = false;
+    
+    for(size_t rule = 0; rule < rulesNum; ++rule)
+    {
+        if(a[rule] > b[rule])
+            return false;
+        
+        if(a[rule] < b[rule])
+            better = true;
+    }
+    
+    return better;
+}
+
+// Pareto front of a stream of repairs, kept up to date one repair at a time (block-nested-loop skyline)
+// only the non-dominated repairs are stored, so a whole answer set file goes through in little memory
+struct ParetoFront
+{
+    ParetoFront(size_t RulesNum = 0)
+    {
+        rulesNum = RulesNum;
+    }
+    
+    // returns false if the repair is dominated by the front (and so not added)
+    bool Add(const std::vector<unsigned int> &costs, size_t repair)
+    {
+        if(costs.size() > rulesNum)
+            Widen(costs.size());
+        
+        row.assign(costs.begin(), costs.end());
+        row.resize(rulesNum, 0);
+        
+        size_t kept = 0;
+        
+        for(size_t i = 0; i < repairs.size(); ++i)
+        {
+            const unsigned int *member = memberCosts.data() + i * rulesNum;
+            
+            if(Dominates(member, row.data(), rulesNum))
+                return false;
+            
+            // members dominated by the new repair leave the front
+            if(Dominates(row.data(), member, rulesNum))
+                continue;
+            
+            if(kept != i)
+            {
+                repairs[kept] = repairs[i];
+                std::copy(member, member + rulesNum, memberCosts.data() + kept * rulesNum);
+            }
+            
+            ++kept;
+        }
+        
+        repairs.resize(kept);
+        memberCosts.resize(kept * rulesNum);
+        
+        repairs.push_back(repair);
+        memberCosts.insert(memberCosts.end(), row.begin(), row.end());
+        
+        return true;
+    }
+    
+    // a rule seen for the first time costs 0 in every repair before it
+    void Widen(size_t newRulesNum)
+    {
+        std::vector<unsigned int> widened(repairs.size() * newRulesNum, 0);
+        
+        for(size_t i = 0; i < repairs.size(); ++i)
+            std::copy(memberCosts.data() + i * rulesNum, memberCosts.data() + i * rulesNum + rulesNum, widened.data() + i * newRulesNum);
+        
+        memberCosts.swap(widened);
+        rulesNum = newRulesNum;
+    }
+    
+    size_t rulesNum;
+    
+    std::vector<size_t> repairs; // index of each repair of the front in the stream
+    std::vector<unsigned int> memberCosts; // their costs, one row per repair
+    
+    std::vector<unsigned int> row;
+};
+
+// sorts [first, last) with threadsNum threads (0: one per core): each thread sorts a slice, then the slices are merged
+// pairwise, again in parallel; compare must be a strict total order for the result not to depend on threadsNum
+template<typename Iterator, typename Compare>
+void ParallelSort(Iterator first, Iterator last, Compare compare, unsigned int threadsNum = 0)
+{
+    size_t size = last - first;
+    
+    if(threadsNum == 0)
+        threadsNum = std::thread::hardware_concurrency();
+    
+    // slices below a few thousand elements are not worth a thread
+    threadsNum = (unsigned int)std::max((size_t)1, std::min((size_t)threadsNum, size / 4096));
+    
+    if(threadsNum == 1)
+    {
+        std::sort(first, last, compare);
+        return;
+    }
+    
+    std::vector<size_t> bounds(threadsNum + 1);
+    
+    for(unsigned int t = 0; t <= threadsNum; ++t)
+        bounds[t] = size * t / threadsNum;
+    
+    std::vector<std::thread> threads;
+    
+    for(unsigned int t = 0; t < threadsNum; ++t)
+    {
+        Iterator begin = first + bounds[t];
+        Iterator end = first + bounds[t + 1];
+        
+        threads.push_back(std::thread([=]() { std::sort(begin, end, compare); }));
+    }
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+    
+    for(unsigned int width = 1; width < threadsNum; width *= 2)
+    {
+        threads.clear();
+        
+        for(unsigned int t = 0; t + width < threadsNum; t += 2 * width)
+        {
+            Iterator begin = first + bounds[t];
+            Iterator middle = first + bounds[t + width];
+            Iterator end = first + bounds[std::min(t + 2 * width, threadsNum)];
+            
+            threads.push_back(std::thread([=]() { std::inplace_merge(begin, middle, end, compare); }));
+        }
+        
+        for(size_t t = 0; t < threads.size(); ++t)
+            threads[t].join();
+    }
+}
+
+// non-dominated sort: layer 0 is the Pareto front, layer 1 the front once layer 0 is removed, and so on
+// efficient non-dominated sort with binary search (Zhang et al. 2015): repairs are visited in lexicographic order of
+// their costs, so everything that can dominate a repair comes before it, and the layer of each repair is the first
+// layer that has no member dominating it (found by binary search, as domination carries over to earlier layers)
+// only the first maxLayers layers are told apart, every repair below them gets layer maxLayers (0: all layers)
+// returns the number of layers
+size_t NonDominatedSort(const RepairCostTable &table, std::vector<unsigned int> &layers, size_t maxLayers = 0)
+{
+    size_t rulesNum = table.RulesNum();
+    size_t repairsNum = table.repairsNum;
+    
+    layers.assign(repairsNum, 0);
+    
+    if(repairsNum == 0)
+        return 0;
+    
+    // row per repair for the comparisons (the table is a column per rule)
+    std::vector<unsigned int> rows(repairsNum * rulesNum);
+    
+    for(size_t rule = 0; rule < rulesNum; ++rule)
+    {
+        const unsigned int *column = table.columns[rule].data();
+        
+        for(size_t i = 0; i < repairsNum; ++i)
+            rows[i * rulesNum + rule] = column[i];
+    }
+    
+    std::vector<unsigned int> order(repairsNum);
+    
+    for(size_t i = 0; i < repairsNum; ++i)
+        order[i] = i;
+    
+    std::sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b)
+    {
+        return std::lexicographical_compare(rows.data() + a * rulesNum, rows.data() + a * rulesNum + rulesNum, rows.data() + b * rulesNum, rows.data() + b * rulesNum + rulesNum);
+    });
+    
+    std::vector<std::vector<unsigned int>> fronts;
+    
+    for(size_t i = 0; i < repairsNum; ++i)
+    {
+        unsigned int repair = order[i];
+        const unsigned int *costs = rows.data() + repair * rulesNum;
+        
+        size_t low = 0;
+        size_t high = fronts.size();
+        
+        while(low < high)
+        {
+            size_t middle = (low + high) / 2;
+            
+            bool dominated = false;
+            
+            // the last members added are the closest in the order, so the most likely to dominate
+            for(size_t m = fronts[middle].size(); m-- > 0 && !dominated;)
+                dominated = Dominates(rows.data() + fronts[middle][m] * rulesNum, costs, rulesNum);
+            
+            if(dominated)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        
+        if(low == maxLayers && maxLayers > 0)
+        {
+            layers[repair] = (unsigned int)maxLayers;
+            continue;
+        }
+        
+        if(low == fronts.size())
+            fronts.push_back(std::vector<unsigned int>());
+        
+        fronts[low].push_back(repair);
+        layers[repair] = (unsigned int)low;
+    }
+    
+    return fronts.size();
+}
+
+
+// read-only view of a whole file: memory-mapped when possible, otherwise read into a buffer in one go
+struct MappedFile
+{
+    MappedFile()
+    {
+        data = nullptr;
+        size = 0;
+        mapped = false;
+    }
+    
+    ~MappedFile()
+    {
+        Close();
+    }
+    
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    
+    bool Open(const std::string &fileName)
+    {
+        Close();
+        
+        int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+        
+        if(fileDescriptor < 0)
+            return false;
+        
+        struct stat fileStat;
+        
+        if(fstat(fileDescriptor, &fileStat) != 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+        
+        size = (size_t)fileStat.st_size;
+        
+        if(size > 0)
+        {
+            void *address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            
+            if(address != MAP_FAILED)
+            {
+                data = (const char *)address;
+                mapped = true;
+            }
+            else
+            {
+                // some files can't be mapped (pipes, special file systems), read them in one go instead
+                buffer.resize(size);
+                
+                size_t bytesRead = 0;
+                
+                while(bytesRead < size)
+                {
+                    ssize_t result = read(fileDescriptor, &buffer[bytesRead], size - bytesRead);
+                    
+                    if(result <= 0)
+                        break;
+                    
+                    bytesRead += (size_t)result;
+                }
+                
+                size = bytesRead;
+                data = buffer.data();
+            }
+        }
+        
+        close(fileDescriptor);
+        
+        return true;
+    }
+    
+    void Close()
+    {
+        if(mapped)
+            munmap((void *)data, size);
+        
+        data = nullptr;
+        size = 0;
+        mapped = false;
+        
+        buffer.clear();
+    }
+    
+    const char *data;
+    size_t size;
+    
+    bool mapped;
+    std::vector<char> buffer; // only used when the file couldn't be mapped
+};
+
+
+// read-only view over an array owned by someone else (e.g. a mapped snapshot file)
+template<typename T>
+struct ArrayView
+{
+    ArrayView()
+    {
+        data = nullptr;
+        size = 0;
+    }
+    
+    ArrayView(const T *Data, size_t Size)
+    {
+        data = Data;
+        size = Size;
+    }
+    
+    const T &operator[](size_t i) const { return data[i]; }
+    
+    const T *begin() const { return data; }
+    const T *end() const { return data + size; }
+    
+    bool empty() const { return size == 0; }
+    
+    const T *data;
+    size_t size;
+};
+
+
+// *************************************************************************************************
+// Binary snapshot of a GeneNetwork: a fixed header followed by the name and the raw Edge (edges, added
+// and removed edges) and TableElement arrays (each 8-byte aligned), so a mapped snapshot can be used
+// without any parsing.
+// *************************************************************************************************
+
+static_assert(sizeof(Edge) == 3 * sizeof(uint32_t) && std::is_trivially_copyable<Edge>::value, "Edge layout is part of the snapshot format");
+static_assert(sizeof(TableElement) == 3 * sizeof(uint32_t) && std::is_trivially_copyable<TableElement>::value, "TableElement layout is part of the snapshot format");
+
+const char NETWORK_SNAPSHOT_MAGIC[8] = {'G', 'N', 'S', 'N', 'A', 'P', '0', '1'};
+const uint32_t NETWORK_SNAPSHOT_VERSION = 2; // 2: removedEdges
+const uint32_t NETWORK_SNAPSHOT_BYTE_ORDER = 0x01020304; // reads differently on a machine with another endianness
+
+struct NetworkSnapshotHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    
+    uint32_t timeSteps;
+    uint32_t geneNum;
+    uint32_t diameter;
+    float kDegree;
+    float edgesNodesRatio;
+    uint32_t nameLength;
+    
+    uint64_t edgesOffset;
+    uint64_t edgesNum;
+    uint64_t addedEdgesOffset;
+    uint64_t addedEdgesNum;
+    uint64_t removedEdgesOffset;
+    uint64_t removedEdgesNum;
+    uint64_t tableOffset;
+    uint64_t tableNum;
+};
+
+struct NetworkSnapshot
+{
+    NetworkSnapshot()
+    {
+        header = nullptr;
+    }
+    
+    bool Open(const std::string &fileName)
+    {
+        header = nullptr;
+        
+        if(!file.Open(fileName))
+        {
+            std::cout << "ERROR: Unable to open network snapshot " << fileName << "..\n";
+            return false;
+        }
+        
+        if(file.size < sizeof(NetworkSnapshotHeader))
+        {
+            std::cout << "ERROR: " << fileName << " is not a network snapshot..\n";
+            return false;
+        }
+        
+        const NetworkSnapshotHeader *fileHeader = (const NetworkSnapshotHeader *)file.data;
+        
+        if(memcmp(fileHeader->magic, NETWORK_SNAPSHOT_MAGIC, sizeof(NETWORK_SNAPSHOT_MAGIC)) != 0 || fileHeader->byteOrder != NETWORK_SNAPSHOT_BYTE_ORDER)
+        {
+            std::cout << "ERROR: " << fileName << " is not a network snapshot (or was written on a machine with a different byte order)..\n";
+            return false;
+        }
+        
+        if(fileHeader->version != NETWORK_SNAPSHOT_VERSION)
+        {
+            std::cout << "ERROR: Unsupported network snapshot version in " << fileName << "..\n";
+            return false;
+        }
+        
+        // make sure every array is inside the file before handing out views on it
+        if(!IsInFile(sizeof(NetworkSnapshotHeader), fileHeader->nameLength, 1) ||
+           !IsInFile(fileHeader->edgesOffset, fileHeader->edgesNum, sizeof(Edge)) ||
+           !IsInFile(fileHeader->addedEdgesOffset, fileHeader->addedEdgesNum, sizeof(Edge)) ||
+           !IsInFile(fileHeader->removedEdgesOffset, fileHeader->removedEdgesNum, sizeof(Edge)) ||
+           !IsInFile(fileHeader->tableOffset, fileHeader->tableNum, sizeof(TableElement)))
+        {
+            std::cout << "ERROR: Network snapshot " << fileName << " is truncated or corrupted..\n";
+            return false;
+        }
+        
+        header = fileHeader;
+        
+        name = std::string(file.data + sizeof(NetworkSnapshotHeader), header->nameLength);
+        
+        edges = ArrayView<Edge>((const Edge *)(file.data + header->edgesOffset), header->edgesNum);
+        addedEdges = ArrayView<Edge>((const Edge *)(file.data + header->addedEdgesOffset), header->addedEdgesNum);
+        removedEdges = ArrayView<Edge>((const Edge *)(file.data + header->removedEdgesOffset), header->removedEdgesNum);
+        table = ArrayView<TableElement>((const TableElement *)(file.data + header->tableOffset), header->tableNum);
+        
+        return true;
+    }
+    
+    bool IsInFile(uint64_t offset, uint64_t count, uint64_t elementSize) const
+    {
+        if(offset > file.size || (offset % 4) != 0)
+            return false;
+        
+        return count <= (file.size - offset) / elementSize;
+    }
+    
+    // makes a regular (writable) GeneNetwork out of the snapshot
+    void CopyTo(GeneNetwork &geneNetwork) const
+    {
+        geneNetwork.name = name;
+        geneNetwork.timeSteps = header->timeSteps;
+        geneNetwork.geneNum = header->geneNum;
+        
+        geneNetwork.edges.assign(edges.begin(), edges.end());
+        geneNetwork.EdgesChanged();
+        geneNetwork.addedEdges.assign(addedEdges.begin(), addedEdges.end());
+        geneNetwork.removedEdges.assign(removedEdges.begin(), removedEdges.end());
+        geneNetwork.table.assign(table.begin(), table.end());
+        
+        geneNetwork.kDegree = header->kDegree;
+        geneNetwork.edgesNodesRatio = header->edgesNodesRatio;
+        geneNetwork.diameter = header->diameter;
+    }
+    
+    MappedFile file;
+    const NetworkSnapshotHeader *header; // points into the mapped file
+    
+    std::string name;
+    
+    ArrayView<Edge> edges;
+    ArrayView<Edge> addedEdges;
+    ArrayView<Edge> removedEdges;
+    ArrayView<TableElement> table;
+};
+
+
+
+
+
+
+
+GeneNetwork budding;
+GeneNetwork fission;
+GeneNetwork elegans;
+GeneNetwork mammalian;
+GeneNetwork arabidopsis;
+GeneNetwork thcell;
+GeneNetwork synthetic; // see GenerateSyntheticNetwork
+
+
+
+
+
+
+
+void LoadNetworks(int Status)
+{
+    ScopedTimer timer("LoadNetworks");
+    
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    budding.name = "budding";
+    budding.timeSteps = 13;
+    budding.geneNum = 11;
+    
+    if(Status == NOT_CORRUPTED)
+    {
+        // Edges of original network
+        budding.edges.push_back(Edge(ACTIVATES,1,3));
+        budding.edges.push_back(Edge(ACTIVATES,1,2));
+        budding.edges.push_back(Edge(INHIBITS,1,1));
+        budding.edges.push_back(Edge(ACTIVATES,3,4));
+        budding.edges.push_back(Edge(ACTIVATES,2,8));
+        budding.edges.push_back(Edge(INHIBITS,4,9));
+        budding.edges.push_back(Edge(INHIBITS,4,5));
+        budding.edges.push_back(Edge(INHIBITS,4,4));
+        budding.edges.push_back(Edge(ACTIVATES,8,11));
+        budding.edges.push_back(Edge(ACTIVATES,8,10));
+        budding.edges.push_back(Edge(INHIBITS,8,9));
+        budding.edges.push_back(Edge(INHIBITS,8,5));
+        budding.edges.push_back(Edge(INHIBITS,9,10));
+        budding.edges.push_back(Edge(INHIBITS,9,8));
+        budding.edges.push_back(Edge(INHIBITS,5,10));
+        budding.edges.push_back(Edge(ACTIVATES,11,10));
+        budding.edges.push_back(Edge(ACTIVATES,11,7));
+        budding.edges.push_back(Edge(ACTIVATES,11,6));
+        budding.edges.push_back(Edge(INHIBITS,11,11));
+        budding.edges.push_back(Edge(ACTIVATES,10,11));
+        budding.edges.push_back(Edge(ACTIVATES,10,7));
+        budding.edges.push_back(Edge(INHIBITS,10,3));
+        budding.edges.push_back(Edge(INHIBITS,10,2));
+        budding.edges.push_back(Edge(INHIBITS,10,9));
+        budding.edges.push_back(Edge(INHIBITS,10,5));
+        budding.edges.push_back(Edge(INHIBITS,10,6));
+        budding.edges.push_back(Edge(ACTIVATES,7,5));
+        budding.edges.push_back(Edge(ACTIVATES,7,9));
+        budding.edges.push_back(Edge(ACTIVATES,7,6));
+        budding.edges.push_back(Edge(INHIBITS,7,10));
+        budding.edges.push_back(Edge(INHIBITS,7,8));
+        budding.edges.push_back(Edge(INHIBITS,7,7));
+        budding.edges.push_back(Edge(ACTIVATES,6,9));
+        budding.edges.push_back(Edge(INHIBITS,6,6));
+    }
+    else if(Status == CORRUPTED)
+    {
+        // Edges of original network
+        budding.edges.push_back(Edge(ACTIVATES,1,3));
+        budding.edges.push_back(Edge(ACTIVATES,1,2));
+        budding.edges.push_back(Edge(INHIBITS,1,1));
+        budding.edges.push_back(Edge(ACTIVATES,3,4));
+        //budding.edges.push_back(Edge(ACTIVATES,2,8));
+        budding.edges.push_back(Edge(INHIBITS,4,9));
+        budding.edges.push_back(Edge(INHIBITS,4,5));
+        budding.edges.push_back(Edge(INHIBITS,4,4));
+        budding.edges.push_back(Edge(ACTIVATES,8,11));
+        budding.edges.push_back(Edge(ACTIVATES,8,10));
+        budding.edges.push_back(Edge(INHIBITS,8,9));
+        budding.edges.push_back(Edge(INHIBITS,8,5));
+        budding.edges.push_back(Edge(INHIBITS,9,10));
+        //budding.edges.push_back(Edge(INHIBITS,9,8));
+        budding.edges.push_back(Edge(INHIBITS,5,10));
+        budding.edges.push_back(Edge(ACTIVATES,11,10));
+        budding.edges.push_back(Edge(ACTIVATES,11,7));
+        budding.edges.push_back(Edge(ACTIVATES,11,6));
+        budding.edges.push_back(Edge(INHIBITS,11,11));
+        //budding.edges.push_back(Edge(ACTIVATES,10,11));
+        budding.edges.push_back(Edge(ACTIVATES,10,7));
+        //budding.edges.push_back(Edge(INHIBITS,10,3));
+        //budding.edges.push_back(Edge(INHIBITS,10,2));
+        //budding.edges.push_back(Edge(INHIBITS,10,9));
+        budding.edges.push_back(Edge(INHIBITS,10,5));
+        budding.edges.push_back(Edge(INHIBITS,10,6));
+        budding.edges.push_back(Edge(ACTIVATES,7,5));
+        budding.edges.push_back(Edge(ACTIVATES,7,9));
+        budding.edges.push_back(Edge(ACTIVATES,7,6));
+        budding.edges.push_back(Edge(INHIBITS,7,10));
+        //budding.edges.push_back(Edge(INHIBITS,7,8));
+        budding.edges.push_back(Edge(INHIBITS,7,7));
+        budding.edges.push_back(Edge(ACTIVATES,6,9));
+        budding.edges.push_back(Edge(INHIBITS,6,6));
+        
+        
+        budding.addedEdges.push_back(Edge(ACTIVATES,1,5));
+        budding.addedEdges.push_back(Edge(ACTIVATES,1,8));
+        budding.addedEdges.push_back(Edge(ACTIVATES,1,9));
+        budding.addedEdges.push_back(Edge(ACTIVATES,1,11));
+        budding.addedEdges.push_back(Edge(ACTIVATES,2,1));
+        budding.addedEdges.push_back(Edge(ACTIVATES,2,4));
+        budding.addedEdges.push_back(Edge(ACTIVATES,3,8));
+        budding.addedEdges.push_back(Edge(ACTIVATES,7,3));
+        budding.addedEdges.push_back(Edge(ACTIVATES,7,11));
+        budding.addedEdges.push_back(Edge(ACTIVATES,9,3));
+        budding.addedEdges.push_back(Edge(INHIBITS,3,1));
+        budding.addedEdges.push_back(Edge(INHIBITS,5,8));
+        budding.addedEdges.push_back(Edge(INHIBITS,6,1));
+        budding.addedEdges.push_back(Edge(INHIBITS,6,2));
+        budding.addedEdges.push_back(Edge(INHIBITS,6,3));
+        budding.addedEdges.push_back(Edge(INHIBITS,6,4));
+        budding.addedEdges.push_back(Edge(INHIBITS,6,5));
+        budding.addedEdges.push_back(Edge(INHIBITS,6,7));
+        budding.addedEdges.push_back(Edge(INHIBITS,6,8));
+        budding.addedEdges.push_back(Edge(INHIBITS,6,10));
+        budding.addedEdges.push_back(Edge(INHIBITS,7,1));
+        budding.addedEdges.push_back(Edge(INHIBITS,7,2));
+        budding.addedEdges.push_back(Edge(INHIBITS,8,8));
+        budding.addedEdges.push_back(Edge(INHIBITS,9,11));
+        budding.addedEdges.push_back(Edge(INHIBITS,11,2));
+        budding.addedEdges.push_back(Edge(INHIBITS,11,3));
+        budding.addedEdges.push_back(Edge(INHIBITS,11,5));
+        budding.addedEdges.push_back(Edge(INHIBITS,11,9));
+    }
+    
+    // Timeseries table
+    budding.table.push_back(TableElement(ACTIVE,1,1));
+    budding.table.push_back(TableElement(INACTIVE,2,1));
+    budding.table.push_back(TableElement(INACTIVE,3,1));
+    budding.table.push_back(TableElement(INACTIVE,4,1));
+    budding.table.push_back(TableElement(ACTIVE,5,1));
+    budding.table.push_back(TableElement(INACTIVE,6,1));
+    budding.table.push_back(TableElement(INACTIVE,7,1));
+    budding.table.push_back(TableElement(INACTIVE,8,1));
+    budding.table.push_back(TableElement(ACTIVE,9,1));
+    budding.table.push_back(TableElement(INACTIVE,10,1));
+    budding.table.push_back(TableElement(INACTIVE,11,1));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,2));
+    budding.table.push_back(TableElement(ACTIVE,2,2));
+    budding.table.push_back(TableElement(ACTIVE,3,2));
+    budding.table.push_back(TableElement(INACTIVE,4,2));
+    budding.table.push_back(TableElement(ACTIVE,5,2));
+    budding.table.push_back(TableElement(INACTIVE,6,2));
+    budding.table.push_back(TableElement(INACTIVE,7,2));
+    budding.table.push_back(TableElement(INACTIVE,8,2));
+    budding.table.push_back(TableElement(ACTIVE,9,2));
+    budding.table.push_back(TableElement(INACTIVE,10,2));
+    budding.table.push_back(TableElement(INACTIVE,11,2));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,3));
+    budding.table.push_back(TableElement(ACTIVE,2,3));
+    budding.table.push_back(TableElement(ACTIVE,3,3));
+    budding.table.push_back(TableElement(ACTIVE,4,3));
+    budding.table.push_back(TableElement(ACTIVE,5,3));
+    budding.table.push_back(TableElement(INACTIVE,6,3));
+    budding.table.push_back(TableElement(INACTIVE,7,3));
+    budding.table.push_back(TableElement(INACTIVE,8,3));
+    budding.table.push_back(TableElement(ACTIVE,9,3));
+    budding.table.push_back(TableElement(INACTIVE,10,3));
+    budding.table.push_back(TableElement(INACTIVE,11,3));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,4));
+    budding.table.push_back(TableElement(ACTIVE,2,4));
+    budding.table.push_back(TableElement(ACTIVE,3,4));
+    budding.table.push_back(TableElement(ACTIVE,4,4));
+    budding.table.push_back(TableElement(INACTIVE,5,4));
+    budding.table.push_back(TableElement(INACTIVE,6,4));
+    budding.table.push_back(TableElement(INACTIVE,7,4));
+    budding.table.push_back(TableElement(INACTIVE,8,4));
+    budding.table.push_back(TableElement(INACTIVE,9,4));
+    budding.table.push_back(TableElement(INACTIVE,10,4));
+    budding.table.push_back(TableElement(INACTIVE,11,4));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,5));
+    budding.table.push_back(TableElement(ACTIVE,2,5));
+    budding.table.push_back(TableElement(ACTIVE,3,5));
+    budding.table.push_back(TableElement(ACTIVE,4,5));
+    budding.table.push_back(TableElement(INACTIVE,5,5));
+    budding.table.push_back(TableElement(INACTIVE,6,5));
+    budding.table.push_back(TableElement(INACTIVE,7,5));
+    budding.table.push_back(TableElement(ACTIVE,8,5));
+    budding.table.push_back(TableElement(INACTIVE,9,5));
+    budding.table.push_back(TableElement(INACTIVE,10,5));
+    budding.table.push_back(TableElement(INACTIVE,11,5));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,6));
+    budding.table.push_back(TableElement(ACTIVE,2,6));
+    budding.table.push_back(TableElement(ACTIVE,3,6));
+    budding.table.push_back(TableElement(ACTIVE,4,6));
+    budding.table.push_back(TableElement(INACTIVE,5,6));
+    budding.table.push_back(TableElement(INACTIVE,6,6));
+    budding.table.push_back(TableElement(INACTIVE,7,6));
+    budding.table.push_back(TableElement(ACTIVE,8,6));
+    budding.table.push_back(TableElement(INACTIVE,9,6));
+    budding.table.push_back(TableElement(ACTIVE,10,6));
+    budding.table.push_back(TableElement(ACTIVE,11,6));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,7));
+    budding.table.push_back(TableElement(INACTIVE,2,7));
+    budding.table.push_back(TableElement(INACTIVE,3,7));
+    budding.table.push_back(TableElement(ACTIVE,4,7));
+    budding.table.push_back(TableElement(INACTIVE,5,7));
+    budding.table.push_back(TableElement(INACTIVE,6,7));
+    budding.table.push_back(TableElement(ACTIVE,7,7));
+    budding.table.push_back(TableElement(ACTIVE,8,7));
+    budding.table.push_back(TableElement(INACTIVE,9,7));
+    budding.table.push_back(TableElement(ACTIVE,10,7));
+    budding.table.push_back(TableElement(ACTIVE,11,7));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,8));
+    budding.table.push_back(TableElement(INACTIVE,2,8));
+    budding.table.push_back(TableElement(INACTIVE,3,8));
+    budding.table.push_back(TableElement(INACTIVE,4,8));
+    budding.table.push_back(TableElement(INACTIVE,5,8));
+    budding.table.push_back(TableElement(INACTIVE,6,8));
+    budding.table.push_back(TableElement(ACTIVE,7,8));
+    budding.table.push_back(TableElement(INACTIVE,8,8));
+    budding.table.push_back(TableElement(INACTIVE,9,8));
+    budding.table.push_back(TableElement(ACTIVE,10,8));
+    budding.table.push_back(TableElement(ACTIVE,11,8));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,9));
+    budding.table.push_back(TableElement(INACTIVE,2,9));
+    budding.table.push_back(TableElement(INACTIVE,3,9));
+    budding.table.push_back(TableElement(INACTIVE,4,9));
+    budding.table.push_back(TableElement(INACTIVE,5,9));
+    budding.table.push_back(TableElement(INACTIVE,6,9));
+    budding.table.push_back(TableElement(ACTIVE,7,9));
+    budding.table.push_back(TableElement(INACTIVE,8,9));
+    budding.table.push_back(TableElement(INACTIVE,9,9));
+    budding.table.push_back(TableElement(ACTIVE,10,9));
+    budding.table.push_back(TableElement(ACTIVE,11,9));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,10));
+    budding.table.push_back(TableElement(INACTIVE,2,10));
+    budding.table.push_back(TableElement(INACTIVE,3,10));
+    budding.table.push_back(TableElement(INACTIVE,4,10));
+    budding.table.push_back(TableElement(INACTIVE,5,10));
+    budding.table.push_back(TableElement(INACTIVE,6,10));
+    budding.table.push_back(TableElement(ACTIVE,7,10));
+    budding.table.push_back(TableElement(INACTIVE,8,10));
+    budding.table.push_back(TableElement(INACTIVE,9,10));
+    budding.table.push_back(TableElement(ACTIVE,10,10));
+    budding.table.push_back(TableElement(ACTIVE,11,10));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,11));
+    budding.table.push_back(TableElement(INACTIVE,2,11));
+    budding.table.push_back(TableElement(INACTIVE,3,11));
+    budding.table.push_back(TableElement(INACTIVE,4,11));
+    budding.table.push_back(TableElement(INACTIVE,5,11));
+    budding.table.push_back(TableElement(INACTIVE,6,11));
+    budding.table.push_back(TableElement(ACTIVE,7,11));
+    budding.table.push_back(TableElement(INACTIVE,8,11));
+    budding.table.push_back(TableElement(INACTIVE,9,11));
+    budding.table.push_back(TableElement(ACTIVE,10,11));
+    budding.table.push_back(TableElement(ACTIVE,11,11));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,12));
+    budding.table.push_back(TableElement(INACTIVE,2,12));
+    budding.table.push_back(TableElement(INACTIVE,3,12));
+    budding.table.push_back(TableElement(INACTIVE,4,12));
+    budding.table.push_back(TableElement(INACTIVE,5,12));
+    budding.table.push_back(TableElement(INACTIVE,6,12));
+    budding.table.push_back(TableElement(ACTIVE,7,12));
+    budding.table.push_back(TableElement(INACTIVE,8,12));
+    budding.table.push_back(TableElement(INACTIVE,9,12));
+    budding.table.push_back(TableElement(ACTIVE,10,12));
+    budding.table.push_back(TableElement(ACTIVE,11,12));
+    
+    budding.table.push_back(TableElement(INACTIVE,1,13));
+    budding.table.push_back(TableElement(INACTIVE,2,13));
+    budding.table.push_back(TableElement(INACTIVE,3,13));
+    budding.table.push_back(TableElement(INACTIVE,4,13));
+    budding.table.push_back(TableElement(INACTIVE,5,13));
+    budding.table.push_back(TableElement(INACTIVE,6,13));
+    budding.table.push_back(TableElement(ACTIVE,7,13));
+    budding.table.push_back(TableElement(INACTIVE,8,13));
+    budding.table.push_back(TableElement(INACTIVE,9,13));
+    budding.table.push_back(TableElement(ACTIVE,10,13));
+    budding.table.push_back(TableElement(ACTIVE,11,13));
+    
+    //safety check
+    size_t buddingTableSize = budding.geneNum * budding.timeSteps;
+    size_t buddingTableElementsNum = budding.table.size();
+    
+    if(buddingTableSize != buddingTableElementsNum)
+    {
+        std::cout << "\nERROR: missing entries in Budding timeseries table...\n\n";
+        return;
+    }
+    
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    fission.name = "fission";
+    fission.timeSteps = 13;
+    fission.geneNum = 9;
+    
+    if(Status == NOT_CORRUPTED)
+    {
+        // Edges of original network
+        fission.edges.push_back(Edge(INHIBITS,1,3));
+        fission.edges.push_back(Edge(INHIBITS,1,2));
+        fission.edges.push_back(Edge(INHIBITS,1,1));
+        fission.edges.push_back(Edge(INHIBITS,2,6));
+        fission.edges.push_back(Edge(INHIBITS,2,9));
+        fission.edges.push_back(Edge(INHIBITS,3,6));
+        fission.edges.push_back(Edge(INHIBITS,3,9));
+        fission.edges.push_back(Edge(ACTIVATES,4,3));
+        fission.edges.push_back(Edge(ACTIVATES,4,2));
+        fission.edges.push_back(Edge(ACTIVATES,4,8));
+        fission.edges.push_back(Edge(INHIBITS,4,5));
+        fission.edges.push_back(Edge(INHIBITS,4,4));
+        fission.edges.push_back(Edge(ACTIVATES,5,9));
+        fission.edges.push_back(Edge(ACTIVATES,6,5));
+        fission.edges.push_back(Edge(INHIBITS,6,3));
+        fission.edges.push_back(Edge(INHIBITS,6,2));
+        fission.edges.push_back(Edge(INHIBITS,6,8));
+        fission.edges.push_back(Edge(ACTIVATES,7,4));
+        fission.edges.push_back(Edge(INHIBITS,7,6));
+        fission.edges.push_back(Edge(INHIBITS,7,9));
+        fission.edges.push_back(Edge(INHIBITS,7,7));
+        fission.edges.push_back(Edge(INHIBITS,8,9));
+        fission.edges.push_back(Edge(ACTIVATES,9,7));
+        fission.edges.push_back(Edge(INHIBITS,9,3));
+        fission.edges.push_back(Edge(INHIBITS,9,2));
+    }
+    else if(Status == CORRUPTED)
+    {
+        fission.edges.push_back(Edge(INHIBITS,1,3));
+        fission.edges.push_back(Edge(INHIBITS,1,2));
+        fission.edges.push_back(Edge(INHIBITS,1,1));
+        //fission.edges.push_back(Edge(INHIBITS,2,6));
+        //fission.edges.push_back(Edge(INHIBITS,2,9));
+        //fission.edges.push_back(Edge(INHIBITS,3,6));
+        //fission.edges.push_back(Edge(INHIBITS,3,9));
+        fission.edges.push_back(Edge(ACTIVATES,4,3));
+        fission.edges.push_back(Edge(ACTIVATES,4,2));
+        fission.edges.push_back(Edge(ACTIVATES,4,8));
+        fission.edges.push_back(Edge(INHIBITS,4,5));
+        fission.edges.push_back(Edge(INHIBITS,4,4));
+        fission.edges.push_back(Edge(ACTIVATES,5,9));
+        fission.edges.push_back(Edge(ACTIVATES,6,5));
+        fission.edges.push_back(Edge(INHIBITS,6,3));
+        fission.edges.push_back(Edge(INHIBITS,6,2));
+        fission.edges.push_back(Edge(INHIBITS,6,8));
+        fission.edges.push_back(Edge(ACTIVATES,7,4));
+        fission.edges.push_back(Edge(INHIBITS,7,6));
+        fission.edges.push_back(Edge(INHIBITS,7,9));
+        fission.edges.push_back(Edge(INHIBITS,7,7));
+        //fission.edges.push_back(Edge(INHIBITS,8,9));
+        fission.edges.push_back(Edge(ACTIVATES,9,7));
+        fission.edges.push_back(Edge(INHIBITS,9,3));
+        fission.edges.push_back(Edge(INHIBITS,9,2));
+        
+        fission.addedEdges.push_back(Edge(ACTIVATES,2,2));
+        fission.addedEdges.push_back(Edge(ACTIVATES,2,3));
+        fission.addedEdges.push_back(Edge(ACTIVATES,2,8));
+        fission.addedEdges.push_back(Edge(ACTIVATES,3,2));
+        fission.addedEdges.push_back(Edge(ACTIVATES,3,3));
+        fission.addedEdges.push_back(Edge(ACTIVATES,3,8));
+        fission.addedEdges.push_back(Edge(ACTIVATES,8,2));
+        fission.addedEdges.push_back(Edge(ACTIVATES,8,3));
+        fission.addedEdges.push_back(Edge(ACTIVATES,8,8));
+        fission.addedEdges.push_back(Edge(INHIBITS,3,4));
+        fission.addedEdges.push_back(Edge(INHIBITS,3,5));
+        fission.addedEdges.push_back(Edge(INHIBITS,3,7));
+        fission.addedEdges.push_back(Edge(INHIBITS,4,7));
+        fission.addedEdges.push_back(Edge(INHIBITS,7,2));
+        fission.addedEdges.push_back(Edge(INHIBITS,7,3));
+        fission.addedEdges.push_back(Edge(INHIBITS,8,1));
+        fission.addedEdges.push_back(Edge(INHIBITS,8,5));
+        fission.addedEdges.push_back(Edge(INHIBITS,8,6));
+        fission.addedEdges.push_back(Edge(INHIBITS,9,4));
+        fission.addedEdges.push_back(Edge(INHIBITS,9,9));
+        
+    }
+    
+    // Timeseries table
+    fission.table.push_back(TableElement(ACTIVE,1,1));
+    fission.table.push_back(TableElement(ACTIVE,4,1));
+    fission.table.push_back(TableElement(ACTIVE,5,1));
+    fission.table.push_back(TableElement(INACTIVE,2,1));
+    fission.table.push_back(TableElement(INACTIVE,3,1));
+    fission.table.push_back(TableElement(INACTIVE,6,1));
+    fission.table.push_back(TableElement(INACTIVE,7,1));
+    fission.table.push_back(TableElement(INACTIVE,8,1));
+    fission.table.push_back(TableElement(INACTIVE,9,1));
+    fission.table.push_back(TableElement(INACTIVE,2,2));
+    fission.table.push_back(TableElement(INACTIVE,7,2));
+    fission.table.push_back(TableElement(INACTIVE,6,2));
+    fission.table.push_back(TableElement(INACTIVE,3,2));
+    fission.table.push_back(TableElement(INACTIVE,2,3));
+    fission.table.push_back(TableElement(INACTIVE,9,3));
+    fission.table.push_back(TableElement(INACTIVE,6,3));
+    fission.table.push_back(TableElement(INACTIVE,3,3));
+    fission.table.push_back(TableElement(INACTIVE,1,2));
+    fission.table.push_back(TableElement(INACTIVE,5,2));
+    fission.table.push_back(TableElement(INACTIVE,4,2));
+    fission.table.push_back(TableElement(ACTIVE,4,4));
+    fission.table.push_back(TableElement(ACTIVE,8,2));
+    fission.table.push_back(TableElement(ACTIVE,9,2));
+    fission.table.push_back(TableElement(INACTIVE,2,4));
+    fission.table.push_back(TableElement(INACTIVE,9,4));
+    fission.table.push_back(TableElement(INACTIVE,7,4));
+    fission.table.push_back(TableElement(INACTIVE,6,4));
+    fission.table.push_back(TableElement(INACTIVE,3,4));
+    fission.table.push_back(TableElement(INACTIVE,1,3));
+    fission.table.push_back(TableElement(INACTIVE,5,3));
+    fission.table.push_back(TableElement(INACTIVE,4,3));
+    fission.table.push_back(TableElement(ACTIVE,8,3));
+    fission.table.push_back(TableElement(INACTIVE,9,5));
+    fission.table.push_back(TableElement(INACTIVE,7,5));
+    fission.table.push_back(TableElement(INACTIVE,6,5));
+    fission.table.push_back(TableElement(INACTIVE,1,4));
+    fission.table.push_back(TableElement(INACTIVE,5,4));
+    fission.table.push_back(TableElement(ACTIVE,8,4));
+    fission.table.push_back(TableElement(INACTIVE,9,6));
+    fission.table.push_back(TableElement(INACTIVE,7,6));
+    fission.table.push_back(TableElement(INACTIVE,6,6));
+    fission.table.push_back(TableElement(INACTIVE,1,5));
+    fission.table.push_back(TableElement(INACTIVE,5,5));
+    fission.table.push_back(TableElement(INACTIVE,4,5));
+    fission.table.push_back(TableElement(ACTIVE,2,5));
+    fission.table.push_back(TableElement(ACTIVE,8,5));
+    fission.table.push_back(TableElement(ACTIVE,3,5));
+    fission.table.push_back(TableElement(ACTIVE,7,3));
+    fission.table.push_back(TableElement(INACTIVE,9,7));
+    fission.table.push_back(TableElement(INACTIVE,7,7));
+    fission.table.push_back(TableElement(INACTIVE,6,7));
+    fission.table.push_back(TableElement(INACTIVE,1,6));
+    fission.table.push_back(TableElement(INACTIVE,5,6));
+    fission.table.push_back(TableElement(INACTIVE,4,6));
+    fission.table.push_back(TableElement(ACTIVE,2,6));
+    fission.table.push_back(TableElement(ACTIVE,8,6));
+    fission.table.push_back(TableElement(ACTIVE,3,6));
+    fission.table.push_back(TableElement(INACTIVE,9,8));
+    fission.table.push_back(TableElement(INACTIVE,7,8));
+    fission.table.push_back(TableElement(INACTIVE,6,8));
+    fission.table.push_back(TableElement(INACTIVE,1,7));
+    fission.table.push_back(TableElement(INACTIVE,5,7));
+    fission.table.push_back(TableElement(INACTIVE,4,7));
+    fission.table.push_back(TableElement(ACTIVE,2,7));
+    fission.table.push_back(TableElement(ACTIVE,8,7));
+    fission.table.push_back(TableElement(ACTIVE,3,7));
+    fission.table.push_back(TableElement(INACTIVE,9,9));
+    fission.table.push_back(TableElement(INACTIVE,7,9));
+    fission.table.push_back(TableElement(INACTIVE,6,9));
+    fission.table.push_back(TableElement(INACTIVE,1,8));
+    fission.table.push_back(TableElement(INACTIVE,5,8));
+    fission.table.push_back(TableElement(INACTIVE,4,8));
+    fission.table.push_back(TableElement(ACTIVE,2,8));
+    fission.table.push_back(TableElement(ACTIVE,8,8));
+    fission.table.push_back(TableElement(ACTIVE,3,8));
+    fission.table.push_back(TableElement(INACTIVE,9,10));
+    fission.table.push_back(TableElement(INACTIVE,7,10));
+    fission.table.push_back(TableElement(INACTIVE,6,10));
+    fission.table.push_back(TableElement(INACTIVE,1,9));
+    fission.table.push_back(TableElement(INACTIVE,5,9));
+    fission.table.push_back(TableElement(INACTIVE,4,9));
+    fission.table.push_back(TableElement(ACTIVE,2,9));
+    fission.table.push_back(TableElement(ACTIVE,8,9));
+    fission.table.push_back(TableElement(ACTIVE,3,9));
+    fission.table.push_back(TableElement(INACTIVE,9,11));
+    fission.table.push_back(TableElement(INACTIVE,7,11));
+    fission.table.push_back(TableElement(INACTIVE,6,11));
+    fission.table.push_back(TableElement(INACTIVE,1,10));
+    fission.table.push_back(TableElement(INACTIVE,5,10));
+    fission.table.push_back(TableElement(INACTIVE,4,10));
+    fission.table.push_back(TableElement(ACTIVE,2,10));
+    fission.table.push_back(TableElement(ACTIVE,8,10));
+    fission.table.push_back(TableElement(ACTIVE,3,10));
+    fission.table.push_back(TableElement(INACTIVE,9,12));
+    fission.table.push_back(TableElement(INACTIVE,7,12));
+    fission.table.push_back(TableElement(INACTIVE,6,12));
+    fission.table.push_back(TableElement(INACTIVE,1,11));
+    fission.table.push_back(TableElement(INACTIVE,5,11));
+    fission.table.push_back(TableElement(INACTIVE,4,11));
+    fission.table.push_back(TableElement(ACTIVE,2,11));
+    fission.table.push_back(TableElement(ACTIVE,8,11));
+    fission.table.push_back(TableElement(ACTIVE,3,11));
+    fission.table.push_back(TableElement(INACTIVE,9,13));
+    fission.table.push_back(TableElement(INACTIVE,7,13));
+    fission.table.push_back(TableElement(INACTIVE,6,13));
+    fission.table.push_back(TableElement(INACTIVE,1,12));
+    fission.table.push_back(TableElement(INACTIVE,5,12));
+    fission.table.push_back(TableElement(INACTIVE,4,12));
+    fission.table.push_back(TableElement(ACTIVE,2,12));
+    fission.table.push_back(TableElement(ACTIVE,8,12));
+    fission.table.push_back(TableElement(ACTIVE,3,12));
+    fission.table.push_back(TableElement(INACTIVE,1,13));
+    fission.table.push_back(TableElement(INACTIVE,5,13));
+    fission.table.push_back(TableElement(INACTIVE,4,13));
+    fission.table.push_back(TableElement(ACTIVE,2,13));
+    fission.table.push_back(TableElement(ACTIVE,8,13));
+    fission.table.push_back(TableElement(ACTIVE,3,13));
+    
+    //safety check
+    size_t fissionTableSize = fission.geneNum * fission.timeSteps;
+    size_t fissionTableElementsNum = fission.table.size();
+    
+    if(fissionTableSize != fissionTableElementsNum)
+    {
+        std::cout << "\nERROR: missing entries in Fission timeseries table...\n\n";
+        return;
+    }
+    
+    
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    elegans.name = "elegans";
+    elegans.timeSteps = 7;
+    elegans.geneNum = 8;
+    
+    if(Status == NOT_CORRUPTED)
+    {
+        // Edges of original network
+        elegans.edges.push_back(Edge(ACTIVATES,1,7));
+        elegans.edges.push_back(Edge(INHIBITS,1,6));
+        elegans.edges.push_back(Edge(INHIBITS,1,3));
+        elegans.edges.push_back(Edge(INHIBITS,2,1));
+        elegans.edges.push_back(Edge(INHIBITS,2,2));
+        elegans.edges.push_back(Edge(INHIBITS,2,5));
+        elegans.edges.push_back(Edge(ACTIVATES,3,2));
+        elegans.edges.push_back(Edge(INHIBITS,3,5));
+        elegans.edges.push_back(Edge(ACTIVATES,3,4));
+        elegans.edges.push_back(Edge(ACTIVATES,4,2));
+        elegans.edges.push_back(Edge(INHIBITS,4,5));
+        elegans.edges.push_back(Edge(INHIBITS,4,4));
+        elegans.edges.push_back(Edge(ACTIVATES,5,3));
+        elegans.edges.push_back(Edge(ACTIVATES,6,5));
+        elegans.edges.push_back(Edge(INHIBITS,6,1));
+        elegans.edges.push_back(Edge(ACTIVATES,7,6));
+        elegans.edges.push_back(Edge(INHIBITS,7,1));
+        elegans.edges.push_back(Edge(INHIBITS,7,8));
+        elegans.edges.push_back(Edge(INHIBITS,7,7));
+        elegans.edges.push_back(Edge(ACTIVATES,8,5));
+        elegans.edges.push_back(Edge(ACTIVATES,8,1));
+    }
+    else if(Status == CORRUPTED)
+    {
+        elegans.edges.push_back(Edge(ACTIVATES,1,7));
+        elegans.edges.push_back(Edge(INHIBITS,1,6));
+        elegans.edges.push_back(Edge(INHIBITS,1,3));
+        //elegans.edges.push_back(Edge(INHIBITS,2,1));
+        elegans.edges.push_back(Edge(INHIBITS,2,2));
+        elegans.edges.push_back(Edge(INHIBITS,2,5));
+        elegans.edges.push_back(Edge(ACTIVATES,3,2));
+        //elegans.edges.push_back(Edge(INHIBITS,3,5));
+        elegans.edges.push_back(Edge(ACTIVATES,3,4));
+        elegans.edges.push_back(Edge(ACTIVATES,4,2));
+        elegans.edges.push_back(Edge(INHIBITS,4,5));
+        //elegans.edges.push_back(Edge(INHIBITS,4,4));
+        elegans.edges.push_back(Edge(ACTIVATES,5,3));
+        elegans.edges.push_back(Edge(ACTIVATES,6,5));
+        //elegans.edges.push_back(Edge(INHIBITS,6,1));
+        elegans.edges.push_back(Edge(ACTIVATES,7,6));
+        elegans.edges.push_back(Edge(INHIBITS,7,1));
+        //elegans.edges.push_back(Edge(INHIBITS,7,8));
+        elegans.edges.push_back(Edge(INHIBITS,7,7));
+        elegans.edges.push_back(Edge(ACTIVATES,8,5));
+        elegans.edges.push_back(Edge(ACTIVATES,8,1));
+        
+        elegans.addedEdges.push_back(Edge(ACTIVATES,3,7));
+        elegans.addedEdges.push_back(Edge(ACTIVATES,5,6));
+        elegans.addedEdges.push_back(Edge(ACTIVATES,7,2));
+        elegans.addedEdges.push_back(Edge(ACTIVATES,7,3));
+        elegans.addedEdges.push_back(Edge(ACTIVATES,7,5));
+        elegans.addedEdges.push_back(Edge(INHIBITS,1,8));
+        elegans.addedEdges.push_back(Edge(INHIBITS,2,3));
+        elegans.addedEdges.push_back(Edge(INHIBITS,2,8));
+        elegans.addedEdges.push_back(Edge(INHIBITS,3,1));
+        elegans.addedEdges.push_back(Edge(INHIBITS,3,8));
+        elegans.addedEdges.push_back(Edge(INHIBITS,4,8));
+        elegans.addedEdges.push_back(Edge(INHIBITS,5,1));
+        elegans.addedEdges.push_back(Edge(INHIBITS,5,5));
+        elegans.addedEdges.push_back(Edge(INHIBITS,5,7));
+        elegans.addedEdges.push_back(Edge(INHIBITS,5,8));
+        elegans.addedEdges.push_back(Edge(INHIBITS,6,8));
+        elegans.addedEdges.push_back(Edge(INHIBITS,7,4));
+        
+    }
+    
+    
+    // Timeseries table
+    elegans.table.push_back(TableElement(ACTIVE,1,1));
+    elegans.table.push_back(TableElement(ACTIVE,2,1));
+    elegans.table.push_back(TableElement(ACTIVE,3,1));
+    elegans.table.push_back(TableElement(ACTIVE,4,1));
+    elegans.table.push_back(TableElement(ACTIVE,6,1));
+    elegans.table.push_back(TableElement(INACTIVE,5,1));
+    elegans.table.push_back(TableElement(INACTIVE,7,1));
+    elegans.table.push_back(TableElement(INACTIVE,8,1));
+    elegans.table.push_back(TableElement(ACTIVE,2,2));
+    elegans.table.push_back(TableElement(ACTIVE,4,2));
+    elegans.table.push_back(TableElement(INACTIVE,5,2));
+    elegans.table.push_back(TableElement(INACTIVE,8,2));
+    elegans.table.push_back(TableElement(ACTIVE,2,3));
+    elegans.table.push_back(TableElement(ACTIVE,6,3));
+    elegans.table.push_back(TableElement(INACTIVE,5,3));
+    elegans.table.push_back(TableElement(INACTIVE,7,3));
+    elegans.table.push_back(TableElement(INACTIVE,8,3));
+    elegans.table.push_back(TableElement(INACTIVE,1,2));
+    elegans.table.push_back(TableElement(INACTIVE,3,2));
+    elegans.table.push_back(TableElement(INACTIVE,6,2));
+    elegans.table.push_back(TableElement(ACTIVE,6,4));
+    elegans.table.push_back(TableElement(ACTIVE,7,2));
+    elegans.table.push_back(TableElement(INACTIVE,5,4));
+    elegans.table.push_back(TableElement(INACTIVE,7,4));
+    elegans.table.push_back(TableElement(INACTIVE,8,4));
+    elegans.table.push_back(TableElement(INACTIVE,1,3));
+    elegans.table.push_back(TableElement(INACTIVE,3,3));
+    elegans.table.push_back(TableElement(INACTIVE,4,3));
+    elegans.table.push_back(TableElement(ACTIVE,6,5));
+    elegans.table.push_back(TableElement(INACTIVE,7,5));
+    elegans.table.push_back(TableElement(INACTIVE,8,5));
+    elegans.table.push_back(TableElement(INACTIVE,1,4));
+    elegans.table.push_back(TableElement(INACTIVE,2,4));
+    elegans.table.push_back(TableElement(INACTIVE,3,4));
+    elegans.table.push_back(TableElement(INACTIVE,4,4));
+    elegans.table.push_back(TableElement(ACTIVE,3,6));
+    elegans.table.push_back(TableElement(ACTIVE,6,6));
+    elegans.table.push_back(TableElement(INACTIVE,7,6));
+    elegans.table.push_back(TableElement(INACTIVE,8,6));
+    elegans.table.push_back(TableElement(INACTIVE,1,5));
+    elegans.table.push_back(TableElement(INACTIVE,2,5));
+    elegans.table.push_back(TableElement(INACTIVE,3,5));
+    elegans.table.push_back(TableElement(INACTIVE,4,5));
+    elegans.table.push_back(TableElement(ACTIVE,2,7));
+    elegans.table.push_back(TableElement(ACTIVE,3,7));
+    elegans.table.push_back(TableElement(ACTIVE,4,7));
+    elegans.table.push_back(TableElement(ACTIVE,5,5));
+    elegans.table.push_back(TableElement(ACTIVE,6,7));
+    elegans.table.push_back(TableElement(INACTIVE,7,7));
+    elegans.table.push_back(TableElement(INACTIVE,8,7));
+    elegans.table.push_back(TableElement(INACTIVE,1,6));
+    elegans.table.push_back(TableElement(INACTIVE,2,6));
+    elegans.table.push_back(TableElement(INACTIVE,4,6));
+    elegans.table.push_back(TableElement(ACTIVE,5,6));
+    elegans.table.push_back(TableElement(INACTIVE,1,7));
+    elegans.table.push_back(TableElement(ACTIVE,5,7));
+    
+    
+    
+    //safety check
+    size_t elegansTableSize = elegans.geneNum * elegans.timeSteps;
+    size_t elegansTableElementsNum = elegans.table.size();
+    
+    if(elegansTableSize != elegansTableElementsNum)
+    {
+        std::cout << "\nERROR: missing entries in Elegans timeseries table...\n\n";
+        return;
+    }
+    
+    
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    mammalian.name = "mammalian";
+    mammalian.timeSteps = 5;
+    mammalian.geneNum = 10;
+    
+    if(Status == NOT_CORRUPTED)
+    {
+        // Edges of original network
+        mammalian.edges.push_back(Edge(ACTIVATES,1,1));
+        mammalian.edges.push_back(Edge(INHIBITS,1,2));
+        mammalian.edges.push_back(Edge(INHIBITS,1,3));
+        mammalian.edges.push_back(Edge(INHIBITS,2,4));
+        mammalian.edges.push_back(Edge(INHIBITS,2,5));
+        mammalian.edges.push_back(Edge(INHIBITS,2,6));
+        mammalian.edges.push_back(Edge(ACTIVATES,3,3));
+        mammalian.edges.push_back(Edge(ACTIVATES,3,4));
+        mammalian.edges.push_back(Edge(ACTIVATES,3,5));
+        mammalian.edges.push_back(Edge(ACTIVATES,3,9));
+        mammalian.edges.push_back(Edge(ACTIVATES,3,2));
+        mammalian.edges.push_back(Edge(INHIBITS,4,3));
+        mammalian.edges.push_back(Edge(INHIBITS,4,4));
+        mammalian.edges.push_back(Edge(INHIBITS,4,2));
+        mammalian.edges.push_back(Edge(ACTIVATES,5,4));
+        mammalian.edges.push_back(Edge(ACTIVATES,5,6));
+        mammalian.edges.push_back(Edge(ACTIVATES,6,6));
+        mammalian.edges.push_back(Edge(INHIBITS,6,3));
+        mammalian.edges.push_back(Edge(INHIBITS,6,9));
+        mammalian.edges.push_back(Edge(ACTIVATES,6,8));
+        mammalian.edges.push_back(Edge(INHIBITS,6,2));
+        mammalian.edges.push_back(Edge(INHIBITS,6,5));
+        mammalian.edges.push_back(Edge(INHIBITS,6,4));
+        mammalian.edges.push_back(Edge(ACTIVATES,7,9));
+        mammalian.edges.push_back(Edge(INHIBITS,7,10));
+        mammalian.edges.push_back(Edge(ACTIVATES,7,8));
+        mammalian.edges.push_back(Edge(INHIBITS,7,6));
+        mammalian.edges.push_back(Edge(INHIBITS,8,6));
+        mammalian.edges.push_back(Edge(ACTIVATES,8,8));
+        mammalian.edges.push_back(Edge(INHIBITS,9,6));
+        mammalian.edges.push_back(Edge(INHIBITS,9,7));
+        mammalian.edges.push_back(Edge(INHIBITS,9,8));
+        mammalian.edges.push_back(Edge(INHIBITS,9,10));
+        mammalian.edges.push_back(Edge(ACTIVATES,10,7));
+        mammalian.edges.push_back(Edge(INHIBITS,10,9));
+        mammalian.edges.push_back(Edge(INHIBITS,10,3));
+        mammalian.edges.push_back(Edge(INHIBITS,10,2));
+        mammalian.edges.push_back(Edge(INHIBITS,10,5));
+        mammalian.edges.push_back(Edge(ACTIVATES,10,8));
+    }
+    else if(Status == CORRUPTED)
+    {
+        mammalian.edges.push_back(Edge(ACTIVATES,1,1));
+        mammalian.edges.push_back(Edge(INHIBITS,1,2));
+        mammalian.edges.push_back(Edge(INHIBITS,1,3));
+        mammalian.edges.push_back(Edge(INHIBITS,2,4));
+        mammalian.edges.push_back(Edge(INHIBITS,2,5));
+        mammalian.edges.push_back(Edge(INHIBITS,2,6));
+        mammalian.edges.push_back(Edge(ACTIVATES,3,3));
+        //mammalian.edges.push_back(Edge(ACTIVATES,3,4));
+        //mammalian.edges.push_back(Edge(ACTIVATES,3,5));
+        //mammalian.edges.push_back(Edge(ACTIVATES,3,9));
+        mammalian.edges.push_back(Edge(ACTIVATES,3,2));
+        mammalian.edges.push_back(Edge(INHIBITS,4,3));
+        mammalian.edges.push_back(Edge(INHIBITS,4,4));
+        mammalian.edges.push_back(Edge(INHIBITS,4,2));
+        mammalian.edges.push_back(Edge(ACTIVATES,5,4));
+        mammalian.edges.push_back(Edge(ACTIVATES,5,6));
+        mammalian.edges.push_back(Edge(ACTIVATES,6,6));
+        mammalian.edges.push_back(Edge(INHIBITS,6,3));
+        mammalian.edges.push_back(Edge(INHIBITS,6,9));
+        mammalian.edges.push_back(Edge(ACTIVATES,6,8));
+        mammalian.edges.push_back(Edge(INHIBITS,6,2));
+        mammalian.edges.push_back(Edge(INHIBITS,6,5));
+        //mammalian.edges.push_back(Edge(INHIBITS,6,4));
+        mammalian.edges.push_back(Edge(ACTIVATES,7,9));
+        //mammalian.edges.push_back(Edge(INHIBITS,7,10));
+        mammalian.edges.push_back(Edge(ACTIVATES,7,8));
+        mammalian.edges.push_back(Edge(INHIBITS,7,6));
+        mammalian.edges.push_back(Edge(INHIBITS,8,6));
+        //mammalian.edges.push_back(Edge(ACTIVATES,8,8));
+        mammalian.edges.push_back(Edge(INHIBITS,9,6));
+        mammalian.edges.push_back(Edge(INHIBITS,9,7));
+        mammalian.edges.push_back(Edge(INHIBITS,9,8));
+        //mammalian.edges.push_back(Edge(INHIBITS,9,10));
+        mammalian.edges.push_back(Edge(ACTIVATES,10,7));
+        mammalian.edges.push_back(Edge(INHIBITS,10,9));
+        //mammalian.edges.push_back(Edge(INHIBITS,10,3));
+        mammalian.edges.push_back(Edge(INHIBITS,10,2));
+        mammalian.edges.push_back(Edge(INHIBITS,10,5));
+        mammalian.edges.push_back(Edge(ACTIVATES,10,8));
+        
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,5));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,6));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,7));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,8));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,9));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,1,10));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,2,1));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,3,8));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,4,5));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,4,8));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,4,9));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,5,8));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,7,3));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,7,5));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,8,3));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,8,4));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,9,3));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,10,1));
+        mammalian.addedEdges.push_back(Edge(ACTIVATES,10,4));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,2,7));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,2,8));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,2,9));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,2,10));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,3,1));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,4,6));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,5,7));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,6,1));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,6,7));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,6,10));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,7,2));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,8,10));
+        mammalian.addedEdges.push_back(Edge(INHIBITS,9,2));
+        
+        
+    }
+    
+    
+    // Timeseries table
+    mammalian.table.push_back(TableElement(INACTIVE,1,1));
+    mammalian.table.push_back(TableElement(INACTIVE,2,1));
+    mammalian.table.push_back(TableElement(INACTIVE,4,1));
+    mammalian.table.push_back(TableElement(INACTIVE,5,1));
+    mammalian.table.push_back(TableElement(INACTIVE,6,1));
+    mammalian.table.push_back(TableElement(INACTIVE,7,1));
+    mammalian.table.push_back(TableElement(INACTIVE,8,1));
+    mammalian.table.push_back(TableElement(INACTIVE,9,1));
+    mammalian.table.push_back(TableElement(ACTIVE,3,1));
+    mammalian.table.push_back(TableElement(ACTIVE,10,1));
+    mammalian.table.push_back(TableElement(ACTIVE,3,2));
+    mammalian.table.push_back(TableElement(ACTIVE,10,2));
+    mammalian.table.push_back(TableElement(INACTIVE,1,2));
+    mammalian.table.push_back(TableElement(INACTIVE,2,2));
+    mammalian.table.push_back(TableElement(INACTIVE,5,2));
+    mammalian.table.push_back(TableElement(INACTIVE,6,2));
+    mammalian.table.push_back(TableElement(INACTIVE,9,2));
+    mammalian.table.push_back(TableElement(ACTIVE,3,3));
+    mammalian.table.push_back(TableElement(INACTIVE,1,3));
+    mammalian.table.push_back(TableElement(INACTIVE,2,3));
+    mammalian.table.push_back(TableElement(INACTIVE,5,3));
+    mammalian.table.push_back(TableElement(INACTIVE,6,3));
+    mammalian.table.push_back(TableElement(INACTIVE,9,3));
+    mammalian.table.push_back(TableElement(ACTIVE,3,4));
+    mammalian.table.push_back(TableElement(ACTIVE,4,2));
+    mammalian.table.push_back(TableElement(ACTIVE,7,2));
+    mammalian.table.push_back(TableElement(ACTIVE,8,2));
+    mammalian.table.push_back(TableElement(INACTIVE,1,4));
+    mammalian.table.push_back(TableElement(INACTIVE,2,4));
+    mammalian.table.push_back(TableElement(INACTIVE,6,4));
+    mammalian.table.push_back(TableElement(ACTIVE,3,5));
+    mammalian.table.push_back(TableElement(ACTIVE,4,3));
+    mammalian.table.push_back(TableElement(ACTIVE,7,3));
+    mammalian.table.push_back(TableElement(ACTIVE,8,3));
+    mammalian.table.push_back(TableElement(INACTIVE,1,5));
+    mammalian.table.push_back(TableElement(INACTIVE,2,5));
+    mammalian.table.push_back(TableElement(INACTIVE,6,5));
+    mammalian.table.push_back(TableElement(INACTIVE,7,5));
+    mammalian.table.push_back(TableElement(ACTIVE,4,4));
+    mammalian.table.push_back(TableElement(ACTIVE,5,4));
+    mammalian.table.push_back(TableElement(ACTIVE,7,4));
+    mammalian.table.push_back(TableElement(ACTIVE,8,4));
+    mammalian.table.push_back(TableElement(ACTIVE,9,4));
+    mammalian.table.push_back(TableElement(INACTIVE,10,3));
+    mammalian.table.push_back(TableElement(ACTIVE,4,5));
+    mammalian.table.push_back(TableElement(ACTIVE,5,5));
+    mammalian.table.push_back(TableElement(ACTIVE,8,5));
+    mammalian.table.push_back(TableElement(ACTIVE,9,5));
+    mammalian.table.push_back(TableElement(INACTIVE,10,4));
+    mammalian.table.push_back(TableElement(INACTIVE,10,5));
+    
+    
+    
+    
+    //safety check
+    size_t mammalianTableSize = mammalian.geneNum * mammalian.timeSteps;
+    size_t mammalianTableElementsNum = mammalian.table.size();
+    
+    if(mammalianTableSize != mammalianTableElementsNum)
+    {
+        std::cout << "\nERROR: missing entries in Mammalian timeseries table...\n\n";
+        return;
+    }
+    
+    
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    arabidopsis.name = "arabidopsis";
+    arabidopsis.timeSteps = 5;
+    arabidopsis.geneNum = 10;
+    
+    if(Status == NOT_CORRUPTED)
+    {
+        // Edges of original network
+        arabidopsis.edges.push_back(Edge(ACTIVATES,1,3));
+        arabidopsis.edges.push_back(Edge(INHIBITS,1,2));
+        arabidopsis.edges.push_back(Edge(INHIBITS,1,6));
+        arabidopsis.edges.push_back(Edge(INHIBITS,2,4));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,2,6));
+        arabidopsis.edges.push_back(Edge(INHIBITS,3,4));
+        arabidopsis.edges.push_back(Edge(INHIBITS,3,6));
+        arabidopsis.edges.push_back(Edge(INHIBITS,4,2));
+        arabidopsis.edges.push_back(Edge(INHIBITS,5,4));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,6,4));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,6,2));
+        arabidopsis.edges.push_back(Edge(INHIBITS,6,3));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,6,9));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,6,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,7,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,7,9));
+        arabidopsis.edges.push_back(Edge(INHIBITS,8,9));
+        arabidopsis.edges.push_back(Edge(INHIBITS,8,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,9,9));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,9,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,10,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,10,9));
+    }
+    else if(Status == CORRUPTED)
+    {
+        //arabidopsis.edges.push_back(Edge(ACTIVATES,1,3));
+        arabidopsis.edges.push_back(Edge(INHIBITS,1,2));
+        //arabidopsis.edges.push_back(Edge(INHIBITS,1,6));
+        arabidopsis.edges.push_back(Edge(INHIBITS,2,4));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,2,6));
+        arabidopsis.edges.push_back(Edge(INHIBITS,3,4));
+        arabidopsis.edges.push_back(Edge(INHIBITS,3,6));
+        arabidopsis.edges.push_back(Edge(INHIBITS,4,2));
+        arabidopsis.edges.push_back(Edge(INHIBITS,5,4));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,6,4));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,6,2));
+        arabidopsis.edges.push_back(Edge(INHIBITS,6,3));
+        //arabidopsis.edges.push_back(Edge(ACTIVATES,6,9));
+        //arabidopsis.edges.push_back(Edge(ACTIVATES,6,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,7,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,7,9));
+        arabidopsis.edges.push_back(Edge(INHIBITS,8,9));
+        arabidopsis.edges.push_back(Edge(INHIBITS,8,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,9,9));
+        //arabidopsis.edges.push_back(Edge(ACTIVATES,9,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,10,7));
+        arabidopsis.edges.push_back(Edge(ACTIVATES,10,9));
+        
+        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,1,7));
+        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,1,9));
+        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,4,3));
+        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,7,1));
+        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,10,6));
+        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,10,8));
+        arabidopsis.addedEdges.push_back(Edge(ACTIVATES,10,10));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,2,8));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,2,9));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,2,10));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,3));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,5));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,6));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,7));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,8));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,5,10));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,6,6));
+        arabidopsis.addedEdges.push_back(Edge(INHIBITS,7,6));
+        
+        
+    }
+    
+    
+    // Timeseries table
+    arabidopsis.table.push_back(TableElement(ACTIVE,1,1));
+    arabidopsis.table.push_back(TableElement(ACTIVE,6,1));
+    arabidopsis.table.push_back(TableElement(INACTIVE,2,1));
+    arabidopsis.table.push_back(TableElement(INACTIVE,3,1));
+    arabidopsis.table.push_back(TableElement(INACTIVE,4,1));
+    arabidopsis.table.push_back(TableElement(INACTIVE,5,1));
+    arabidopsis.table.push_back(TableElement(INACTIVE,7,1));
+    arabidopsis.table.push_back(TableElement(INACTIVE,8,1));
+    arabidopsis.table.push_back(TableElement(INACTIVE,9,1));
+    arabidopsis.table.push_back(TableElement(INACTIVE,10,1));
+    arabidopsis.table.push_back(TableElement(ACTIVE,1,2));
+    arabidopsis.table.push_back(TableElement(INACTIVE,2,2));
+    arabidopsis.table.push_back(TableElement(INACTIVE,3,2));
+    arabidopsis.table.push_back(TableElement(INACTIVE,5,2));
+    arabidopsis.table.push_back(TableElement(INACTIVE,8,2));
+    arabidopsis.table.push_back(TableElement(INACTIVE,10,2));
+    arabidopsis.table.push_back(TableElement(ACTIVE,1,3));
+    arabidopsis.table.push_back(TableElement(INACTIVE,2,3));
+    arabidopsis.table.push_back(TableElement(INACTIVE,5,3));
+    arabidopsis.table.push_back(TableElement(INACTIVE,8,3));
+    arabidopsis.table.push_back(TableElement(INACTIVE,10,3));
+    arabidopsis.table.push_back(TableElement(INACTIVE,6,2));
+    arabidopsis.table.push_back(TableElement(ACTIVE,1,4));
+    arabidopsis.table.push_back(TableElement(ACTIVE,4,2));
+    arabidopsis.table.push_back(TableElement(ACTIVE,7,2));
+    arabidopsis.table.push_back(TableElement(ACTIVE,9,2));
+    arabidopsis.table.push_back(TableElement(INACTIVE,2,4));
+    arabidopsis.table.push_back(TableElement(INACTIVE,4,4));
+    arabidopsis.table.push_back(TableElement(INACTIVE,5,4));
+    arabidopsis.table.push_back(TableElement(INACTIVE,8,4));
+    arabidopsis.table.push_back(TableElement(INACTIVE,10,4));
+    arabidopsis.table.push_back(TableElement(INACTIVE,6,3));
+    arabidopsis.table.push_back(TableElement(ACTIVE,1,5));
+    arabidopsis.table.push_back(TableElement(ACTIVE,4,3));
+    arabidopsis.table.push_back(TableElement(ACTIVE,7,3));
+    arabidopsis.table.push_back(TableElement(ACTIVE,9,3));
+    arabidopsis.table.push_back(TableElement(ACTIVE,3,3));
+    arabidopsis.table.push_back(TableElement(INACTIVE,2,5));
+    arabidopsis.table.push_back(TableElement(INACTIVE,4,5));
+    arabidopsis.table.push_back(TableElement(INACTIVE,5,5));
+    arabidopsis.table.push_back(TableElement(INACTIVE,8,5));
+    arabidopsis.table.push_back(TableElement(INACTIVE,10,5));
+    arabidopsis.table.push_back(TableElement(INACTIVE,6,4));
+    arabidopsis.table.push_back(TableElement(ACTIVE,3,4));
+    arabidopsis.table.push_back(TableElement(ACTIVE,7,4));
+    arabidopsis.table.push_back(TableElement(ACTIVE,9,4));
+    arabidopsis.table.push_back(TableElement(INACTIVE,6,5));
+    arabidopsis.table.push_back(TableElement(ACTIVE,3,5));
+    arabidopsis.table.push_back(TableElement(ACTIVE,7,5));
+    arabidopsis.table.push_back(TableElement(ACTIVE,9,5));
+    
+    
+    
+    //safety check
+    size_t arabidopsisTableSize = arabidopsis.geneNum * arabidopsis.timeSteps;
+    size_t arabidopsisTableElementsNum = arabidopsis.table.size();
+    
+    if(arabidopsisTableSize != arabidopsisTableElementsNum)
+    {
+        std::cout << "\nERROR: missing entries in Arabidopsis timeseries table...\n\n";
+        return;
+    }
+    
+    
+    
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    //***********************************************************************************************************************************
+    thcell.name = "thcell";
+    thcell.timeSteps = 10;
+    thcell.geneNum = 51;
+    
+    
+    // Edges of original network
+    //IRF4 		1
+    //IL13 		2
+    //NFAT 		3
+    //MAF 		4
+    //GATA3 	5
+    //IL5		6
+    //IFNGR		7
+    //TBET		8
+    //STAT1		9
+    //IL7R		10
+    //IFNG		11
+    //STAT4		12
+    //IRAK		13
+    //STAT6		14
+    //IL7		15
+    //IL18		16
+    //IL4R		17
+    //IFNAR1	18
+    //IFNA		19
+    //IL4		20
+    //SOCS1		21
+    //CD80		22
+    //CTLA4		23
+    //SHP1		24
+    //CD45		25
+    //LCK		26
+    //CD4		27
+    //TCR		28
+    //ZAP70		29
+    //CD3		30
+    //SLP76		31
+    //VAV1		32
+    //CD28		33
+    //ITK		34
+    //PLCPG		35
+    //ANTIGEN	36
+    //TNFSF4	37
+    //TNFRSF4	38
+    //NFKB		39
+    //IKBKB		40
+    //PI3K		41
+    //ICOS		42
+    //AKT1		43
+    //COT		44
+    //NIK		45
+    //CD86		46
+    //JAK1		47
+    //JAK3		48
+    //IL12R		49
+    //IL12		50
+    //IL18R		51
+    
+    thcell.edges.push_back(Edge(ACTIVATES,1,2));
+    thcell.edges.push_back(Edge(ACTIVATES,3,2));
+    thcell.edges.push_back(Edge(ACTIVATES,4,2));
+    thcell.edges.push_back(Edge(ACTIVATES,5,2));
+    thcell.edges.push_back(Edge(ACTIVATES,1,6));
+    thcell.edges.push_back(Edge(ACTIVATES,3,6));
+    thcell.edges.push_back(Edge(ACTIVATES,4,6));
+    thcell.edges.push_back(Edge(ACTIVATES,5,6));
+    thcell.edges.push_back(Edge(ACTIVATES,7,8));
+    thcell.edges.push_back(Edge(INHIBITS,5,8));
+    thcell.edges.push_back(Edge(ACTIVATES,9,8));
+    thcell.edges.push_back(Edge(ACTIVATES,10,11));
+    thcell.edges.push_back(Edge(ACTIVATES,8,11));
+    thcell.edges.push_back(Edge(ACTIVATES,12,11));
+    thcell.edges.push_back(Edge(ACTIVATES,9,11));
+    thcell.edges.push_back(Edge(ACTIVATES,13,11));
+    thcell.edges.push_back(Edge(ACTIVATES,14,4));
+    thcell.edges.push_back(Edge(ACTIVATES,14,5));
+    thcell.edges.push_back(Edge(INHIBITS,8,5));
+    thcell.edges.push_back(Edge(ACTIVATES,15,10));
+    thcell.edges.push_back(Edge(ACTIVATES,16,51));
+    thcell.edges.push_back(Edge(INHIBITS,17,51));
+    thcell.edges.push_back(Edge(ACTIVATES,51,13));
+    thcell.edges.push_back(Edge(ACTIVATES,18,9));
+    thcell.edges.push_back(Edge(ACTIVATES,7,9));
+    thcell.edges.push_back(Edge(ACTIVATES,19,18));
+    thcell.edges.push_back(Edge(ACTIVATES,11,7));
+    thcell.edges.push_back(Edge(ACTIVATES,20,17));
+    thcell.edges.push_back(Edge(INHIBITS,21,17));
+    thcell.edges.push_back(Edge(ACTIVATES,1,20));
+    thcell.edges.push_back(Edge(ACTIVATES,3,20));
+    thcell.edges.push_back(Edge(ACTIVATES,4,20));
+    thcell.edges.push_back(Edge(ACTIVATES,5,20));
+    thcell.edges.push_back(Edge(ACTIVATES,22,23));
+    thcell.edges.push_back(Edge(ACTIVATES,23,24));
+    thcell.edges.push_back(Edge(ACTIVATES,25,26));
+    thcell.edges.push_back(Edge(ACTIVATES,27,26));
+    thcell.edges.push_back(Edge(ACTIVATES,28,29));
+    thcell.edges.push_back(Edge(ACTIVATES,30,29));
+    thcell.edges.push_back(Edge(INHIBITS,24,29));
+    thcell.edges.push_back(Edge(ACTIVATES,26,29));
+    thcell.edges.push_back(Edge(ACTIVATES,29,31));
+    thcell.edges.push_back(Edge(ACTIVATES,26,32));
+    thcell.edges.push_back(Edge(ACTIVATES,33,34));
+    thcell.edges.push_back(Edge(ACTIVATES,32,34));
+    thcell.edges.push_back(Edge(ACTIVATES,31,34));
+    thcell.edges.push_back(Edge(ACTIVATES,34,35));
+    thcell.edges.push_back(Edge(ACTIVATES,36,27));
+    thcell.edges.push_back(Edge(ACTIVATES,36,28));
+    thcell.edges.push_back(Edge(ACTIVATES,36,30));
+    thcell.edges.push_back(Edge(ACTIVATES,36,25));
+    thcell.edges.push_back(Edge(ACTIVATES,37,38));
+    thcell.edges.push_back(Edge(INHIBITS,7,39));
+    thcell.edges.push_back(Edge(ACTIVATES,38,39));
+    thcell.edges.push_back(Edge(ACTIVATES,40,39));
+    thcell.edges.push_back(Edge(ACTIVATES,14,1));
+    thcell.edges.push_back(Edge(ACTIVATES,39,1));
+    thcell.edges.push_back(Edge(ACTIVATES,33,3));
+    thcell.edges.push_back(Edge(ACTIVATES,38,3));
+    thcell.edges.push_back(Edge(ACTIVATES,35,3));
+    thcell.edges.push_back(Edge(ACTIVATES,1,3));
+    thcell.edges.push_back(Edge(ACTIVATES,33,41));
+    thcell.edges.push_back(Edge(ACTIVATES,42,41));
+    thcell.edges.push_back(Edge(ACTIVATES,41,43));
+    thcell.edges.push_back(Edge(ACTIVATES,43,44));
+    thcell.edges.push_back(Edge(ACTIVATES,44,45));
+    thcell.edges.push_back(Edge(ACTIVATES,45,40));
+    thcell.edges.push_back(Edge(ACTIVATES,46,33));
+    thcell.edges.push_back(Edge(ACTIVATES,17,47));
+    thcell.edges.push_back(Edge(INHIBITS,24,47));
+    thcell.edges.push_back(Edge(INHIBITS,21,47));
+    thcell.edges.push_back(Edge(ACTIVATES,17,48));
+    thcell.edges.push_back(Edge(ACTIVATES,18,14));
+    thcell.edges.push_back(Edge(ACTIVATES,47,14));
+    thcell.edges.push_back(Edge(ACTIVATES,48,14));
+    thcell.edges.push_back(Edge(ACTIVATES,49,12));
+    thcell.edges.push_back(Edge(ACTIVATES,18,12));
+    thcell.edges.push_back(Edge(INHIBITS,14,12));
+    thcell.edges.push_back(Edge(ACTIVATES,7,21));
+    thcell.edges.push_back(Edge(ACTIVATES,9,21));
+    thcell.edges.push_back(Edge(ACTIVATES,8,21));
+    thcell.edges.push_back(Edge(ACTIVATES,50,49));
+    thcell.edges.push_back(Edge(ACTIVATES,37,42));
+    
+    
+    
+    
+    // Added edges to corrupt the network
+    thcell.addedEdges.push_back(Edge(INHIBITS,6,19));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,11,49));
+    thcell.addedEdges.push_back(Edge(INHIBITS,20,34));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,41,17));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,39,26));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,23,14));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,43,39));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,34,44));
+    thcell.addedEdges.push_back(Edge(INHIBITS,13,27));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,45,20));
+    thcell.addedEdges.push_back(Edge(INHIBITS,7,43));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,42,12));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,20,38));
+    thcell.addedEdges.push_back(Edge(INHIBITS,17,49));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,12,48));
+    thcell.addedEdges.push_back(Edge(INHIBITS,48,42));
+    thcell.addedEdges.push_back(Edge(INHIBITS,5,19));
+    thcell.addedEdges.push_back(Edge(INHIBITS,50,36));
+    thcell.addedEdges.push_back(Edge(INHIBITS,40,51));
+    thcell.addedEdges.push_back(Edge(ACTIVATES,5,3));
+    
+    
+    
+    
+    // Timeseries table
+    thcell.table.push_back(TableElement(INACTIVE,1,1));
+    thcell.table.push_back(TableElement(INACTIVE,2,1));
+    thcell.table.push_back(TableElement(INACTIVE,3,1));
+    thcell.table.push_back(TableElement(INACTIVE,4,1));
+    thcell.table.push_back(TableElement(INACTIVE,5,1));
+    thcell.table.push_back(TableElement(INACTIVE,6,1));
+    thcell.table.push_back(TableElement(INACTIVE,7,1));
+    thcell.table.push_back(TableElement(INACTIVE,8,1));
+    thcell.table.push_back(TableElement(INACTIVE,9,1));
+    thcell.table.push_back(TableElement(INACTIVE,10,1));
+    thcell.table.push_back(TableElement(INACTIVE,11,1));
+    thcell.table.push_back(TableElement(INACTIVE,12,1));
+    thcell.table.push_back(TableElement(INACTIVE,13,1));
+    thcell.table.push_back(TableElement(INACTIVE,14,1));
+    thcell.table.push_back(TableElement(INACTIVE,17,1));
+    thcell.table.push_back(TableElement(INACTIVE,18,1));
+    thcell.table.push_back(TableElement(INACTIVE,20,1));
+    thcell.table.push_back(TableElement(INACTIVE,21,1));
+    thcell.table.push_back(TableElement(INACTIVE,23,1));
+    thcell.table.push_back(TableElement(INACTIVE,24,1));
+    thcell.table.push_back(TableElement(INACTIVE,25,1));
+    thcell.table.push_back(TableElement(INACTIVE,26,1));
+    thcell.table.push_back(TableElement(INACTIVE,27,1));
+    thcell.table.push_back(TableElement(INACTIVE,28,1));
+    thcell.table.push_back(TableElement(INACTIVE,29,1));
+    thcell.table.push_back(TableElement(INACTIVE,30,1));
+    thcell.table.push_back(TableElement(INACTIVE,31,1));
+    thcell.table.push_back(TableElement(INACTIVE,32,1));
+    thcell.table.push_back(TableElement(INACTIVE,33,1));
+    thcell.table.push_back(TableElement(INACTIVE,34,1));
+    thcell.table.push_back(TableElement(INACTIVE,35,1));
+    thcell.table.push_back(TableElement(INACTIVE,38,1));
+    thcell.table.push_back(TableElement(INACTIVE,39,1));
+    thcell.table.push_back(TableElement(INACTIVE,40,1));
+    thcell.table.push_back(TableElement(INACTIVE,41,1));
+    thcell.table.push_back(TableElement(INACTIVE,42,1));
+    thcell.table.push_back(TableElement(INACTIVE,43,1));
+    thcell.table.push_back(TableElement(INACTIVE,44,1));
+    thcell.table.push_back(TableElement(INACTIVE,45,1));
+    thcell.table.push_back(TableElement(INACTIVE,47,1));
+    thcell.table.push_back(TableElement(INACTIVE,48,1));
+    thcell.table.push_back(TableElement(INACTIVE,49,1));
+    thcell.table.push_back(TableElement(INACTIVE,51,1));
+    thcell.table.push_back(TableElement(ACTIVE,15,1));
+    thcell.table.push_back(TableElement(ACTIVE,16,1));
+    thcell.table.push_back(TableElement(ACTIVE,19,1));
+    thcell.table.push_back(TableElement(ACTIVE,22,1));
+    thcell.table.push_back(TableElement(ACTIVE,36,1));
+    thcell.table.push_back(TableElement(ACTIVE,37,1));
+    thcell.table.push_back(TableElement(ACTIVE,46,1));
+    thcell.table.push_back(TableElement(ACTIVE,50,1));
+    thcell.table.push_back(TableElement(ACTIVE,15,2));
+    thcell.table.push_back(TableElement(ACTIVE,16,2));
+    thcell.table.push_back(TableElement(ACTIVE,19,2));
+    thcell.table.push_back(TableElement(ACTIVE,22,2));
+    thcell.table.push_back(TableElement(ACTIVE,36,2));
+    thcell.table.push_back(TableElement(ACTIVE,37,2));
+    thcell.table.push_back(TableElement(ACTIVE,46,2));
+    thcell.table.push_back(TableElement(ACTIVE,50,2));
+    thcell.table.push_back(TableElement(INACTIVE,1,2));
+    thcell.table.push_back(TableElement(INACTIVE,2,2));
+    thcell.table.push_back(TableElement(INACTIVE,3,2));
+    thcell.table.push_back(TableElement(INACTIVE,4,2));
+    thcell.table.push_back(TableElement(INACTIVE,5,2));
+    thcell.table.push_back(TableElement(INACTIVE,6,2));
+    thcell.table.push_back(TableElement(INACTIVE,7,2));
+    thcell.table.push_back(TableElement(INACTIVE,8,2));
+    thcell.table.push_back(TableElement(INACTIVE,9,2));
+    thcell.table.push_back(TableElement(INACTIVE,11,2));
+    thcell.table.push_back(TableElement(INACTIVE,12,2));
+    thcell.table.push_back(TableElement(INACTIVE,13,2));
+    thcell.table.push_back(TableElement(INACTIVE,14,2));
+    thcell.table.push_back(TableElement(INACTIVE,17,2));
+    thcell.table.push_back(TableElement(INACTIVE,20,2));
+    thcell.table.push_back(TableElement(INACTIVE,21,2));
+    thcell.table.push_back(TableElement(INACTIVE,24,2));
+    thcell.table.push_back(TableElement(INACTIVE,26,2));
+    thcell.table.push_back(TableElement(INACTIVE,29,2));
+    thcell.table.push_back(TableElement(INACTIVE,31,2));
+    thcell.table.push_back(TableElement(INACTIVE,32,2));
+    thcell.table.push_back(TableElement(INACTIVE,34,2));
+    thcell.table.push_back(TableElement(INACTIVE,35,2));
+    thcell.table.push_back(TableElement(INACTIVE,39,2));
+    thcell.table.push_back(TableElement(INACTIVE,40,2));
+    thcell.table.push_back(TableElement(INACTIVE,41,2));
+    thcell.table.push_back(TableElement(INACTIVE,43,2));
+    thcell.table.push_back(TableElement(INACTIVE,44,2));
+    thcell.table.push_back(TableElement(INACTIVE,45,2));
+    thcell.table.push_back(TableElement(INACTIVE,47,2));
+    thcell.table.push_back(TableElement(INACTIVE,48,2));
+    thcell.table.push_back(TableElement(ACTIVE,15,3));
+    thcell.table.push_back(TableElement(ACTIVE,16,3));
+    thcell.table.push_back(TableElement(ACTIVE,19,3));
+    thcell.table.push_back(TableElement(ACTIVE,22,3));
+    thcell.table.push_back(TableElement(ACTIVE,36,3));
+    thcell.table.push_back(TableElement(ACTIVE,37,3));
+    thcell.table.push_back(TableElement(ACTIVE,46,3));
+    thcell.table.push_back(TableElement(ACTIVE,50,3));
+    thcell.table.push_back(TableElement(INACTIVE,1,3));
+    thcell.table.push_back(TableElement(INACTIVE,2,3));
+    thcell.table.push_back(TableElement(INACTIVE,4,3));
+    thcell.table.push_back(TableElement(INACTIVE,5,3));
+    thcell.table.push_back(TableElement(INACTIVE,6,3));
+    thcell.table.push_back(TableElement(INACTIVE,7,3));
+    thcell.table.push_back(TableElement(INACTIVE,8,3));
+    thcell.table.push_back(TableElement(INACTIVE,17,3));
+    thcell.table.push_back(TableElement(INACTIVE,20,3));
+    thcell.table.push_back(TableElement(INACTIVE,21,3));
+    thcell.table.push_back(TableElement(INACTIVE,31,3));
+    thcell.table.push_back(TableElement(INACTIVE,32,3));
+    thcell.table.push_back(TableElement(INACTIVE,35,3));
+    thcell.table.push_back(TableElement(INACTIVE,40,3));
+    thcell.table.push_back(TableElement(INACTIVE,43,3));
+    thcell.table.push_back(TableElement(INACTIVE,44,3));
+    thcell.table.push_back(TableElement(INACTIVE,45,3));
+    thcell.table.push_back(TableElement(INACTIVE,47,3));
+    thcell.table.push_back(TableElement(INACTIVE,48,3));
+    thcell.table.push_back(TableElement(ACTIVE,15,4));
+    thcell.table.push_back(TableElement(ACTIVE,16,4));
+    thcell.table.push_back(TableElement(ACTIVE,19,4));
+    thcell.table.push_back(TableElement(ACTIVE,22,4));
+    thcell.table.push_back(TableElement(ACTIVE,36,4));
+    thcell.table.push_back(TableElement(ACTIVE,37,4));
+    thcell.table.push_back(TableElement(ACTIVE,46,4));
+    thcell.table.push_back(TableElement(ACTIVE,50,4));
+    thcell.table.push_back(TableElement(ACTIVE,10,2));
+    thcell.table.push_back(TableElement(ACTIVE,18,2));
+    thcell.table.push_back(TableElement(ACTIVE,23,2));
+    thcell.table.push_back(TableElement(ACTIVE,25,2));
+    thcell.table.push_back(TableElement(ACTIVE,27,2));
+    thcell.table.push_back(TableElement(ACTIVE,28,2));
+    thcell.table.push_back(TableElement(ACTIVE,30,2));
+    thcell.table.push_back(TableElement(ACTIVE,33,2));
+    thcell.table.push_back(TableElement(ACTIVE,38,2));
+    thcell.table.push_back(TableElement(ACTIVE,42,2));
+    thcell.table.push_back(TableElement(ACTIVE,49,2));
+    thcell.table.push_back(TableElement(ACTIVE,51,2));
+    thcell.table.push_back(TableElement(INACTIVE,17,4));
+    thcell.table.push_back(TableElement(INACTIVE,40,4));
+    thcell.table.push_back(TableElement(INACTIVE,44,4));
+    thcell.table.push_back(TableElement(INACTIVE,45,4));
+    thcell.table.push_back(TableElement(INACTIVE,47,4));
+    thcell.table.push_back(TableElement(INACTIVE,48,4));
+    thcell.table.push_back(TableElement(ACTIVE,10,3));
+    thcell.table.push_back(TableElement(ACTIVE,15,5));
+    thcell.table.push_back(TableElement(ACTIVE,16,5));
+    thcell.table.push_back(TableElement(ACTIVE,18,3));
+    thcell.table.push_back(TableElement(ACTIVE,19,5));
+    thcell.table.push_back(TableElement(ACTIVE,22,5));
+    thcell.table.push_back(TableElement(ACTIVE,23,3));
+    thcell.table.push_back(TableElement(ACTIVE,25,3));
+    thcell.table.push_back(TableElement(ACTIVE,27,3));
+    thcell.table.push_back(TableElement(ACTIVE,28,3));
+    thcell.table.push_back(TableElement(ACTIVE,30,3));
+    thcell.table.push_back(TableElement(ACTIVE,33,3));
+    thcell.table.push_back(TableElement(ACTIVE,36,5));
+    thcell.table.push_back(TableElement(ACTIVE,37,5));
+    thcell.table.push_back(TableElement(ACTIVE,38,3));
+    thcell.table.push_back(TableElement(ACTIVE,42,3));
+    thcell.table.push_back(TableElement(ACTIVE,46,5));
+    thcell.table.push_back(TableElement(ACTIVE,49,3));
+    thcell.table.push_back(TableElement(ACTIVE,50,5));
+    thcell.table.push_back(TableElement(ACTIVE,51,3));
+    thcell.table.push_back(TableElement(INACTIVE,17,5));
+    thcell.table.push_back(TableElement(INACTIVE,40,5));
     thcell.table.push_back(TableElement(INACTIVE,45,5));
     thcell.table.push_back(TableElement(INACTIVE,47,5));
     thcell.table.push_back(TableElement(INACTIVE,48,5));
@@ -1891,1260 +3623,4254 @@ void LoadNetworks(int Status)
     thcell.table.push_back(TableElement(ACTIVE,40,9));
     thcell.table.push_back(TableElement(ACTIVE,40,10));
     
-    //safety check
-    size_t thcellTableSize = thcell.geneNum * thcell.timeSteps;
-    size_t thcellTableElementsNum = thcell.table.size();
+    //safety check
+    size_t thcellTableSize = thcell.geneNum * thcell.timeSteps;
+    size_t thcellTableElementsNum = thcell.table.size();
+    
+    if(thcellTableSize != thcellTableElementsNum)
+    {
+        std::cout << "\nERROR: missing entries in thcell timeseries table...\n\n";
+        return;
+    }
+    
+    
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    
+    timer.Count("edges", budding.edges.size() + fission.edges.size() + elegans.edges.size() + mammalian.edges.size() + arabidopsis.edges.size() + thcell.edges.size());
+    
+    std::cout << "\n\nFINISHED LOADING NETWORKS!\n\n";
+}
+
+GeneNetwork *GetNetwork(const std::string &name)
+{
+    if(name == "budding")
+        return &budding;
+    else if(name == "fission")
+        return &fission;
+    else if(name == "elegans")
+        return &elegans;
+    else if(name == "mammalian")
+        return &mammalian;
+    else if(name == "arabidopsis")
+        return &arabidopsis;
+    else if(name == "thcell")
+        return &thcell;
+    else if(name == "synthetic")
+        return &synthetic;
+    
+    return nullptr;
+}
+
+
+// *************************************************************************************************
+// Network files: one record per line, fields separated by tabs, commas, semicolons or spaces.
+// Lines starting with '#' are comments, and a header row is allowed on the first line.
+//
+//   <name>_edges.tsv       type from to    (type: activates/inhibits or 1/-1, same signs as the ASP file)
+//   <name>_addedEdges.tsv  type from to    (optional, edges added to corrupt the network)
+//   <name>_removedEdges.tsv type from to   (optional, edges removed to corrupt the network, see CorruptNetwork)
+//   <name>_table.tsv       type gene time  (type: active/inactive or 1/0)
+//
+// The number of genes and time steps are the largest gene and time found in the files.
+// *************************************************************************************************
+
+// reads the next record of a network file, skipping empty and comment lines
+// returns the number of fields found (0 at the end of the file)
+size_t ReadNetworkFileRecord(const char *&position, const char *fileEnd, unsigned int &lineNumber, const char *fieldBegins[3], const char *fieldEnds[3])
+{
+    while(position < fileEnd)
+    {
+        const char *lineEnd = (const char *)memchr(position, '\n', fileEnd - position);
+        
+        if(lineEnd == nullptr)
+            lineEnd = fileEnd;
+        
+        ++lineNumber;
+        
+        size_t fieldsNum = 0;
+        const char *current = position;
+        
+        position = (lineEnd < fileEnd) ? lineEnd + 1 : fileEnd;
+        
+        while(current < lineEnd)
+        {
+            char character = *current;
+            
+            if(character == '\t' || character == ',' || character == ';' || character == ' ' || character == '\r')
+            {
+                ++current;
+                continue;
+            }
+            
+            // comment (or the rest of the line after 3 fields)
+            if(character == '#' || fieldsNum == 3)
+                break;
+            
+            fieldBegins[fieldsNum] = current;
+            
+            while(current < lineEnd && *current != '\t' && *current != ',' && *current != ';' && *current != ' ' && *current != '\r')
+                ++current;
+            
+            fieldEnds[fieldsNum] = current;
+            ++fieldsNum;
+        }
+        
+        if(fieldsNum > 0)
+            return fieldsNum;
+    }
+    
+    return 0;
+}
+
+bool ParseNetworkFileNumber(const char *begin, const char *end, int &value)
+{
+    if(begin < end && *begin == '+')
+        ++begin;
+    
+    std::from_chars_result result = std::from_chars(begin, end, value);
+    
+    return (result.ec == std::errc()) && (result.ptr == end);
+}
+
+bool NetworkFileFieldEquals(const char *begin, const char *end, const char *word)
+{
+    size_t length = strlen(word);
+    
+    return ((size_t)(end - begin) == length) && (memcmp(begin, word, length) == 0);
+}
+
+bool LoadEdgesFile(const std::string &fileName, std::vector<Edge> &edges)
+{
+    MappedFile file;
+    
+    if(!file.Open(fileName))
+    {
+        std::cout << "ERROR: Unable to open edges file " << fileName << "..\n";
+        return false;
+    }
+    
+    const char *position = file.data;
+    const char *fileEnd = file.data + file.size;
+    
+    unsigned int lineNumber = 0;
+    bool firstRecord = true;
+    
+    const char *fieldBegins[3];
+    const char *fieldEnds[3];
+    
+    // rough guess of the number of edges, to avoid reallocations on big networks
+    edges.reserve(edges.size() + file.size / 8);
+    
+    size_t fieldsNum;
+    while((fieldsNum = ReadNetworkFileRecord(position, fileEnd, lineNumber, fieldBegins, fieldEnds)) != 0)
+    {
+        int type = -1;
+        int sign = 0;
+        int from = 0;
+        int to = 0;
+        
+        if(NetworkFileFieldEquals(fieldBegins[0], fieldEnds[0], "activates"))
+            type = ACTIVATES;
+        else if(NetworkFileFieldEquals(fieldBegins[0], fieldEnds[0], "inhibits"))
+            type = INHIBITS;
+        else if(ParseNetworkFileNumber(fieldBegins[0], fieldEnds[0], sign) && (sign == 1 || sign == -1))
+            type = (sign == 1) ? ACTIVATES : INHIBITS;
+        
+        bool valid = (fieldsNum == 3) && (type != -1);
+        
+        valid = valid && ParseNetworkFileNumber(fieldBegins[1], fieldEnds[1], from) && (from > 0);
+        valid = valid && ParseNetworkFileNumber(fieldBegins[2], fieldEnds[2], to) && (to > 0);
+        
+        if(!valid)
+        {
+            // the first line may be a header row
+            if(firstRecord)
+            {
+                firstRecord = false;
+                continue;
+            }
+            
+            std::cout << "ERROR: Invalid edge at line " << lineNumber << " of " << fileName << "..\n";
+            return false;
+        }
+        
+        firstRecord = false;
+        
+        edges.push_back(Edge(type, from, to));
+    }
+    
+    edges.shrink_to_fit();
+    
+    return true;
+}
+
+bool LoadTableFile(const std::string &fileName, std::vector<TableElement> &table)
+{
+    MappedFile file;
+    
+    if(!file.Open(fileName))
+    {
+        std::cout << "ERROR: Unable to open timeseries table file " << fileName << "..\n";
+        return false;
+    }
+    
+    const char *position = file.data;
+    const char *fileEnd = file.data + file.size;
+    
+    unsigned int lineNumber = 0;
+    bool firstRecord = true;
+    
+    const char *fieldBegins[3];
+    const char *fieldEnds[3];
+    
+    table.reserve(table.size() + file.size / 8);
+    
+    size_t fieldsNum;
+    while((fieldsNum = ReadNetworkFileRecord(position, fileEnd, lineNumber, fieldBegins, fieldEnds)) != 0)
+    {
+        int type = -1;
+        int state = -1;
+        int gene = 0;
+        int time = 0;
+        
+        if(NetworkFileFieldEquals(fieldBegins[0], fieldEnds[0], "active"))
+            type = ACTIVE;
+        else if(NetworkFileFieldEquals(fieldBegins[0], fieldEnds[0], "inactive"))
+            type = INACTIVE;
+        else if(ParseNetworkFileNumber(fieldBegins[0], fieldEnds[0], state) && (state == 0 || state == 1))
+            type = (state == 1) ? ACTIVE : INACTIVE;
+        
+        bool valid = (fieldsNum == 3) && (type != -1);
+        
+        valid = valid && ParseNetworkFileNumber(fieldBegins[1], fieldEnds[1], gene) && (gene > 0);
+        valid = valid && ParseNetworkFileNumber(fieldBegins[2], fieldEnds[2], time) && (time > 0);
+        
+        if(!valid)
+        {
+            if(firstRecord)
+            {
+                firstRecord = false;
+                continue;
+            }
+            
+            std::cout << "ERROR: Invalid timeseries entry at line " << lineNumber << " of " << fileName << "..\n";
+            return false;
+        }
+        
+        firstRecord = false;
+        
+        table.push_back(TableElement(type, gene, time));
+    }
+    
+    table.shrink_to_fit();
+    
+    return true;
+}
+
+// loads a network from files instead of the hardcoded LoadNetworks() (addedEdgesFileName can be empty)
+bool LoadNetworkFromFiles(GeneNetwork &geneNetwork, const std::string &name, const std::string &edgesFileName, const std::string &addedEdgesFileName, const std::string &tableFileName)
+{
+    ScopedTimer timer("LoadNetworkFromFiles", name);
+    
+    geneNetwork.name = name;
+    geneNetwork.timeSteps = 0;
+    geneNetwork.geneNum = 0;
+    
+    geneNetwork.edges.clear();
+    geneNetwork.addedEdges.clear();
+    geneNetwork.removedEdges.clear();
+    geneNetwork.table.clear();
+    geneNetwork.EdgesChanged();
+    
+    if(!LoadEdgesFile(edgesFileName, geneNetwork.edges))
+        return false;
+    
+    if(!addedEdgesFileName.empty() && !LoadEdgesFile(addedEdgesFileName, geneNetwork.addedEdges))
+        return false;
+    
+    if(!LoadTableFile(tableFileName, geneNetwork.table))
+        return false;
+    
+    timer.Count("edges", geneNetwork.edges.size() + geneNetwork.addedEdges.size());
+    timer.Count("tableElements", geneNetwork.table.size());
+    
+    for(size_t i = 0; i < geneNetwork.edges.size(); ++i)
+        geneNetwork.geneNum = std::max(geneNetwork.geneNum, std::max(geneNetwork.edges[i].from, geneNetwork.edges[i].to));
+    
+    for(size_t i = 0; i < geneNetwork.addedEdges.size(); ++i)
+        geneNetwork.geneNum = std::max(geneNetwork.geneNum, std::max(geneNetwork.addedEdges[i].from, geneNetwork.addedEdges[i].to));
+    
+    for(size_t i = 0; i < geneNetwork.table.size(); ++i)
+    {
+        geneNetwork.geneNum = std::max(geneNetwork.geneNum, geneNetwork.table[i].gene);
+        geneNetwork.timeSteps = std::max(geneNetwork.timeSteps, geneNetwork.table[i].time);
+    }
+    
+    //safety check
+    size_t tableSize = (size_t)geneNetwork.geneNum * geneNetwork.timeSteps;
+    size_t tableElementsNum = geneNetwork.table.size();
+    
+    if(tableSize != tableElementsNum)
+    {
+        std::cout << "\nERROR: missing entries in " << name << " timeseries table...\n\n";
+        return false;
+    }
+    
+    return true;
+}
+
+// loads <directory>/<name>_edges.tsv, <name>_addedEdges.tsv and <name>_removedEdges.tsv (if they exist) and <name>_table.tsv
+// into the network with that name
+bool LoadNetworkFromDirectory(const std::string &name, const std::string &directory)
+{
+    GeneNetwork *geneNetwork = GetNetwork(name);
+    
+    if(geneNetwork == nullptr)
+    {
+        std::cout << "ERROR: Unknown network " << name << "..\n";
+        return false;
+    }
+    
+    std::string prefix = directory + "/" + name;
+    std::string addedEdgesFileName = prefix + "_addedEdges.tsv";
+    
+    if(access(addedEdgesFileName.c_str(), F_OK) != 0)
+        addedEdgesFileName.clear();
+    
+    if(!LoadNetworkFromFiles(*geneNetwork, name, prefix + "_edges.tsv", addedEdgesFileName, prefix + "_table.tsv"))
+        return false;
+    
+    std::string removedEdgesFileName = prefix + "_removedEdges.tsv";
+    
+    if(access(removedEdgesFileName.c_str(), F_OK) == 0 && !LoadEdgesFile(removedEdgesFileName, geneNetwork->removedEdges))
+        return false;
+    
+    std::cout << "\n\nFINISHED LOADING " << name << " NETWORK FROM FILES!\n\n";
+    
+    return true;
+}
+
+bool SaveEdgesFile(const std::string &fileName, const std::vector<Edge> &edges)
+{
+    std::ofstream edgesFile(fileName);
+    
+    if(!edgesFile.is_open())
+    {
+        std::cout << "ERROR: Unable to create network files..\n";
+        return false;
+    }
+    
+    edgesFile << "type\tfrom\tto\n";
+    
+    for(size_t i = 0; i < edges.size(); ++i)
+        edgesFile << (edges[i].type == ACTIVATES ? "activates" : "inhibits") << "\t" << edges[i].from << "\t" << edges[i].to << "\n";
+    
+    return true;
+}
+
+// writes a network in the format read by LoadNetworkFromDirectory() (used to move the hardcoded networks to files)
+bool SaveNetworkToFiles(const GeneNetwork &geneNetwork, const std::string &directory)
+{
+    std::string prefix = directory + "/" + geneNetwork.name;
+    
+    if(!SaveEdgesFile(prefix + "_edges.tsv", geneNetwork.edges))
+        return false;
+    
+    if(!geneNetwork.addedEdges.empty() && !SaveEdgesFile(prefix + "_addedEdges.tsv", geneNetwork.addedEdges))
+        return false;
+    
+    if(!geneNetwork.removedEdges.empty() && !SaveEdgesFile(prefix + "_removedEdges.tsv", geneNetwork.removedEdges))
+        return false;
+    
+    std::ofstream tableFile(prefix + "_table.tsv");
+    
+    if(!tableFile.is_open())
+    {
+        std::cout << "ERROR: Unable to create network files..\n";
+        return false;
+    }
+    
+    tableFile << "type\tgene\ttime\n";
+    
+    for(size_t i = 0; i < geneNetwork.table.size(); ++i)
+        tableFile << (geneNetwork.table[i].type == ACTIVE ? "active" : "inactive") << "\t" << geneNetwork.table[i].gene << "\t" << geneNetwork.table[i].time << "\n";
+    
+    return true;
+}
+
+bool SaveNetworkSnapshot(const GeneNetwork &geneNetwork, const std::string &fileName)
+{
+    NetworkSnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    
+    memcpy(header.magic, NETWORK_SNAPSHOT_MAGIC, sizeof(NETWORK_SNAPSHOT_MAGIC));
+    header.version = NETWORK_SNAPSHOT_VERSION;
+    header.byteOrder = NETWORK_SNAPSHOT_BYTE_ORDER;
+    
+    header.timeSteps = geneNetwork.timeSteps;
+    header.geneNum = geneNetwork.geneNum;
+    header.diameter = geneNetwork.diameter;
+    header.kDegree = geneNetwork.kDegree;
+    header.edgesNodesRatio = geneNetwork.edgesNodesRatio;
+    header.nameLength = (uint32_t)geneNetwork.name.size();
+    
+    // every array starts on an 8-byte boundary
+    uint64_t offset = sizeof(NetworkSnapshotHeader) + header.nameLength;
+    
+    offset = (offset + 7) & ~(uint64_t)7;
+    header.edgesOffset = offset;
+    header.edgesNum = geneNetwork.edges.size();
+    offset += header.edgesNum * sizeof(Edge);
+    
+    offset = (offset + 7) & ~(uint64_t)7;
+    header.addedEdgesOffset = offset;
+    header.addedEdgesNum = geneNetwork.addedEdges.size();
+    offset += header.addedEdgesNum * sizeof(Edge);
+    
+    offset = (offset + 7) & ~(uint64_t)7;
+    header.removedEdgesOffset = offset;
+    header.removedEdgesNum = geneNetwork.removedEdges.size();
+    offset += header.removedEdgesNum * sizeof(Edge);
+    
+    offset = (offset + 7) & ~(uint64_t)7;
+    header.tableOffset = offset;
+    header.tableNum = geneNetwork.table.size();
+    offset += header.tableNum * sizeof(TableElement);
+    
+    std::vector<char> buffer(offset, 0);
+    
+    memcpy(&buffer[0], &header, sizeof(header));
+    memcpy(&buffer[sizeof(header)], geneNetwork.name.data(), header.nameLength);
+    
+    if(header.edgesNum > 0)
+        memcpy(&buffer[header.edgesOffset], geneNetwork.edges.data(), header.edgesNum * sizeof(Edge));
+    
+    if(header.addedEdgesNum > 0)
+        memcpy(&buffer[header.addedEdgesOffset], geneNetwork.addedEdges.data(), header.addedEdgesNum * sizeof(Edge));
+    
+    if(header.removedEdgesNum > 0)
+        memcpy(&buffer[header.removedEdgesOffset], geneNetwork.removedEdges.data(), header.removedEdgesNum * sizeof(Edge));
+    
+    if(header.tableNum > 0)
+        memcpy(&buffer[header.tableOffset], geneNetwork.table.data(), header.tableNum * sizeof(TableElement));
+    
+    std::ofstream file(fileName, std::ios::binary);
+    
+    if(!file.is_open())
+    {
+        std::cout << "ERROR: Unable to create network snapshot..\n";
+        return false;
+    }
+    
+    file.write(buffer.data(), buffer.size());
+    
+    return file.good();
+}
+
+// loads a snapshot into the network with the same name
+// NOTE: this copies every array into the network's vectors (CopyTo), so it only skips parsing: loading is still
+// O(network) and every process holds its own copy. Only code reading a NetworkSnapshot's views directly shares the
+// page-cached file, and nothing in this file does that yet (everything works on GeneNetwork)
+bool LoadNetworkFromSnapshot(const std::string &fileName)
+{
+    NetworkSnapshot snapshot;
+    
+    if(!snapshot.Open(fileName))
+        return false;
+    
+    GeneNetwork *geneNetwork = GetNetwork(snapshot.name);
+    
+    if(geneNetwork == nullptr)
+    {
+        std::cout << "ERROR: Unknown network " << snapshot.name << " in snapshot..\n";
+        return false;
+    }
+    
+    snapshot.CopyTo(*geneNetwork);
+    
+    std::cout << "\n\nFINISHED LOADING " << snapshot.name << " NETWORK FROM SNAPSHOT!\n\n";
+    
+    return true;
+}
+
+void LearnNetworkProperties(const std::string &repairNetwork)
+{
+    ScopedTimer timer("LearnNetworkProperties");
+    
+    if(repairNetwork != "budding")
+    {
+        budding.LearnProperties();
+        budding.PrintProperties();
+    }
+    else
+        std::cout << "\n\n REPAIRING BUDDING NETWORK. NO LEARNING FROM BUDDING.\n\n";
+    
+    if(repairNetwork != "fission")
+    {
+        fission.LearnProperties();
+        fission.PrintProperties();
+    }
+    else
+        std::cout << "\n\n REPAIRING FISSION NETWORK. NO LEARNING FROM FISSION.\n\n";
+    
+    if(repairNetwork != "elegans")
+    {
+        elegans.LearnProperties();
+        elegans.PrintProperties();
+    }
+    else
+        std::cout << "\n\n REPAIRING ELEGANS NETWORK. NO LEARNING FROM ELEGANS.\n\n";
+    
+    if(repairNetwork != "mammalian")
+    {
+        mammalian.LearnProperties();
+        mammalian.PrintProperties();
+    }
+    else
+        std::cout << "\n\n REPAIRING MAMMALIAN NETWORK. NO LEARNING FROM MAMMALIAN.\n\n";
+    
+    if(repairNetwork != "arabidopsis")
+    {
+        arabidopsis.LearnProperties();
+        arabidopsis.PrintProperties();
+    }
+    else
+        std::cout << "\n\n REPAIRING ARABIDOPSIS NETWORK. NO LEARNING FROM ARABIDOPSIS.\n\n";
+}
+
+
+// *********************************************************************************************
+// Conflict localization: which (gene, time) cells of the table the current edges of a network
+// (original and added edges, as in the ASP file) can't reproduce, and why
+// *********************************************************************************************
+
+const char *ConflictTypeName(int type)
+{
+    switch(type)
+    {
+        case LACKS_ACTIVATOR: return "lacks activator";
+        case LACKS_INHIBITOR: return "lacks inhibitor";
+        case CONFLICTING_SIGNALS: return "conflicting signals";
+        case UNEXPECTED_ACTIVATION: return "unexpected activation";
+        case UNEXPECTED_INHIBITION: return "unexpected inhibition";
+    }
+    
+    return "unknown";
+}
+
+size_t FindConflicts(const GeneNetwork &geneNetwork, std::vector<Conflict> &conflicts)
+{
+    std::vector<Edge> currentEdges(geneNetwork.edges);
+    currentEdges.insert(currentEdges.end(), geneNetwork.addedEdges.begin(), geneNetwork.addedEdges.end());
+    
+    TableMatrix tableMatrix;
+    tableMatrix.Build(geneNetwork.geneNum, geneNetwork.timeSteps, geneNetwork.table);
+    
+    BooleanNetworkSimulator simulator;
+    simulator.Build(geneNetwork.geneNum, currentEdges);
+    
+    return simulator.FindConflicts(tableMatrix, conflicts);
+}
+
+void CreateConflictReport(const GeneNetwork &geneNetwork, const std::string &outputFileName)
+{
+    std::vector<Conflict> conflicts;
+    FindConflicts(geneNetwork, conflicts);
+    
+    std::ofstream outputFile(outputFileName);
+    
+    if(!outputFile.is_open())
+    {
+        std::cout << "ERROR: Unable to create conflict report file..\n";
+        return;
+    }
+    
+    outputFile << "Network: " << geneNetwork.name << "\n";
+    outputFile << "Edges: " << geneNetwork.edges.size() << " + " << geneNetwork.addedEdges.size() << " added\n\n";
+    
+    // pairs of genes that both activate and inhibit make the ASP program unsatisfiable on their own
+    EdgeSet currentEdgeSet;
+    
+    std::vector<Edge> currentEdges(geneNetwork.edges);
+    currentEdges.insert(currentEdges.end(), geneNetwork.addedEdges.begin(), geneNetwork.addedEdges.end());
+    currentEdgeSet.Build(currentEdges);
+    
+    for(size_t i = 0; i < currentEdges.size(); ++i)
+    {
+        if(currentEdges[i].type == ACTIVATES && currentEdgeSet.Contains(Edge(INHIBITS, currentEdges[i].from, currentEdges[i].to)))
+            outputFile << "Contradictory edges: " << currentEdges[i].from << " both activates and inhibits " << currentEdges[i].to << "\n";
+    }
+    
+    outputFile << "\nConflicting cells: " << conflicts.size() << " of " << geneNetwork.table.size() << "\n\n";
+    
+    for(size_t i = 0; i < conflicts.size(); ++i)
+        outputFile << "gene " << conflicts[i].gene << ", time " << conflicts[i].time << ": " << ConflictTypeName(conflicts[i].type) << "\n";
+    
+    // genes ordered by number of conflicts, those are the ones the repair should focus on
+    std::vector<std::vector<unsigned int> > geneConflicts(geneNetwork.geneNum + 1, std::vector<unsigned int>(UNEXPECTED_INHIBITION + 1, 0));
+    std::vector<unsigned int> geneTotals(geneNetwork.geneNum + 1, 0);
+    std::vector<unsigned int> conflictingGenes;
+    
+    for(size_t i = 0; i < conflicts.size(); ++i)
+    {
+        ++geneConflicts[conflicts[i].gene][conflicts[i].type];
+        
+        if(geneTotals[conflicts[i].gene]++ == 0)
+            conflictingGenes.push_back(conflicts[i].gene);
+    }
+    
+    std::stable_sort(conflictingGenes.begin(), conflictingGenes.end(), [&](unsigned int a, unsigned int b) { return geneTotals[a] > geneTotals[b]; });
+    
+    outputFile << "\n\nGENES TO REPAIR: " << conflictingGenes.size() << " of " << geneNetwork.geneNum << "\n";
+    outputFile << "================\n\n";
+    
+    for(size_t i = 0; i < conflictingGenes.size(); ++i)
+    {
+        unsigned int gene = conflictingGenes[i];
+        
+        outputFile << "gene " << gene << ": " << geneTotals[gene] << " conflicts (";
+        
+        bool first = true;
+        
+        for(int type = LACKS_ACTIVATOR; type <= UNEXPECTED_INHIBITION; ++type)
+        {
+            if(geneConflicts[gene][type] == 0)
+                continue;
+            
+            outputFile << (first ? "" : ", ") << ConflictTypeName(type) << ": " << geneConflicts[gene][type];
+            first = false;
+        }
+        
+        outputFile << ")\n";
+    }
+    
+    outputFile.close();
+    
+    std::cout << "\n\nFINISHED CREATING CONFLICT REPORT!\n\n";
+}
+
+
+// *********************************************************************************************
+// Candidate additions: an added activation U->V only matters at time steps where U is active at T-1,
+// and it can only help if V is active at T (it either activates V or cancels an inhibition of V).
+// Likewise an added inhibition U->V can only help if V is inactive at T. Every other addition is
+// useless or harmful for consistency, so it is never part of a minimal repair.
+// Unobserved cells are treated as possibly active and possibly inactive.
+// *********************************************************************************************
+
+// returns the number of gene pairs without an edge (the additions the unpruned ASP file allows, per sign)
+size_t FindCandidateEdges(const GeneNetwork &geneNetwork, std::vector<Edge> &candidateEdges)
+{
+    candidateEdges.clear();
+    
+    unsigned int geneNum = geneNetwork.geneNum;
+    
+    TableMatrix tableMatrix;
+    tableMatrix.Build(geneNum, geneNetwork.timeSteps, geneNetwork.table);
+    
+    std::vector<Edge> currentEdges(geneNetwork.edges);
+    currentEdges.insert(currentEdges.end(), geneNetwork.addedEdges.begin(), geneNetwork.addedEdges.end());
+    
+    // edge(U,V) regardless of the sign
+    std::vector<Edge> unsignedEdges;
+    
+    for(size_t i = 0; i < currentEdges.size(); ++i)
+        unsignedEdges.push_back(Edge(ACTIVATES, currentEdges[i].from, currentEdges[i].to));
+    
+    EdgeSet currentEdgeSet;
+    currentEdgeSet.Build(unsignedEdges);
+    
+    size_t wordsPerRow = tableMatrix.wordsPerRow;
+    uint64_t lastWordMask = (geneNum % 64 == 0) ? ~(uint64_t)0 : (((uint64_t)1 << (geneNum % 64)) - 1);
+    
+    std::vector<uint64_t> activatesTargets(wordsPerRow);
+    std::vector<uint64_t> inhibitsTargets(wordsPerRow);
+    
+    size_t possibleAdditions = 0;
+    
+    for(unsigned int from = 1; from <= geneNum; ++from)
+    {
+        std::fill(activatesTargets.begin(), activatesTargets.end(), 0);
+        std::fill(inhibitsTargets.begin(), inhibitsTargets.end(), 0);
+        
+        for(unsigned int time = 2; time <= geneNetwork.timeSteps; ++time)
+        {
+            if(tableMatrix.IsInactive(from, time - 1))
+                continue;
+            
+            const uint64_t *activeRow = tableMatrix.ActiveRow(time);
+            const uint64_t *inactiveRow = tableMatrix.InactiveRow(time);
+            
+            for(size_t w = 0; w < wordsPerRow; ++w)
+            {
+                activatesTargets[w] |= ~inactiveRow[w];
+                inhibitsTargets[w] |= ~activeRow[w];
+            }
+        }
+        
+        if(wordsPerRow > 0)
+        {
+            activatesTargets[wordsPerRow - 1] &= lastWordMask;
+            inhibitsTargets[wordsPerRow - 1] &= lastWordMask;
+        }
+        
+        for(unsigned int to = 1; to <= geneNum; ++to)
+        {
+            if(currentEdgeSet.Contains(Edge(ACTIVATES, from, to)))
+                continue;
+            
+            ++possibleAdditions;
+            
+            if((activatesTargets[(to - 1) / 64] >> ((to - 1) % 64)) & 1)
+                candidateEdges.push_back(Edge(ACTIVATES, from, to));
+            
+            if((inhibitsTargets[(to - 1) / 64] >> ((to - 1) % 64)) & 1)
+                candidateEdges.push_back(Edge(INHIBITS, from, to));
+        }
+    }
+    
+    return possibleAdditions;
+}
+
+
+// *************************************************************************************************
+// Solver output (clasp/clingo text format): every "Answer: N" line is followed by one line with the
+// atoms of the answer set, separated by spaces and in any order. activates(X,Y), inhibits(X,Y) and
+// repairCost(R,C) are read, every other atom (and every other line) is skipped.
+// *************************************************************************************************
+
+// one answer set of a solver output file, reused from answer to answer so reading doesn't allocate per atom
+struct AnswerSet
+{
+    AnswerSet()
+    {
+        number = 0;
+        Clear();
+    }
+    
+    void Clear()
+    {
+        edges.clear();
+        
+        std::fill(repairCosts.begin(), repairCosts.end(), 0);
+        
+        repairCostsNum = 0;
+    }
+    
+    unsigned int number; // N of "Answer: N"
+    
+    std::vector<Edge> edges; // activates/inhibits atoms
+    
+    std::vector<unsigned int> repairCosts; // value of repairCost(R,C) atoms, by rule (0 for rules not in the answer set)
+    unsigned int repairCostsNum; // number of repairCost atoms found
+};
+
+// single pass over a whole solver output file, answer set by answer set
+struct AnswerSetReader
+{
+    AnswerSetReader()
+    {
+        position = nullptr;
+        fileEnd = nullptr;
+    }
+    
+    bool Open(const std::string &fileName)
+    {
+        position = nullptr;
+        fileEnd = nullptr;
+        
+        if(!file.Open(fileName))
+            return false;
+        
+        position = file.data;
+        fileEnd = file.data + file.size;
+        
+        return true;
+    }
+    
+    void Close()
+    {
+        file.Close();
+        
+        position = nullptr;
+        fileEnd = nullptr;
+    }
+    
+    // true if word appears anywhere in the file (e.g. "UNKNOWN" when clasp hit its time limit)
+    bool Contains(const char *word) const
+    {
+        size_t length = strlen(word);
+        
+        return std::search(file.data, file.data + file.size, word, word + length) != file.data + file.size;
+    }
+    
+    // reads the next answer set, returns false at the end of the file
+    bool Next(AnswerSet &answerSet)
+    {
+        while(position < fileEnd)
+        {
+            const char *lineBegin = position;
+            const char *lineEnd = NextLine();
+            
+            if(lineEnd - lineBegin < 7 || memcmp(lineBegin, "Answer:", 7) != 0)
+                continue;
+            
+            answerSet.Clear();
+            answerSet.number = 0;
+            
+            const char *current = lineBegin + 7;
+            
+            while(current < lineEnd && *current == ' ')
+                ++current;
+            
+            std::from_chars(current, lineEnd, answerSet.number);
+            
+            // the atoms are on the next line
+            const char *atomsBegin = position;
+            const char *atomsEnd = NextLine();
+            
+            ParseAtoms(atomsBegin, atomsEnd, answerSet);
+            
+            return true;
+        }
+        
+        return false;
+    }
+    
+    // moves position to the next line and returns the end of the current one
+    const char *NextLine()
+    {
+        const char *lineEnd = (const char *)memchr(position, '\n', fileEnd - position);
+        
+        if(lineEnd == nullptr)
+            lineEnd = fileEnd;
+        
+        position = (lineEnd < fileEnd) ? lineEnd + 1 : fileEnd;
+        
+        return lineEnd;
+    }
+    
+    static void ParseAtoms(const char *current, const char *lineEnd, AnswerSet &answerSet)
+    {
+        while(current < lineEnd)
+        {
+            if(*current == ' ' || *current == '\r')
+            {
+                ++current;
+                continue;
+            }
+            
+            const char *nameBegin = current;
+            
+            while(current < lineEnd && *current != '(' && *current != ' ')
+                ++current;
+            
+            const char *nameEnd = current;
+            
+            int first = 0;
+            int second = 0;
+            
+            // name(first,second), anything else is skipped up to the next space
+            bool isPair = (current < lineEnd && *current == '(');
+            
+            if(isPair)
+                isPair = ParseNumber(++current, lineEnd, first) && current < lineEnd && *current == ',';
+            
+            if(isPair)
+                isPair = ParseNumber(++current, lineEnd, second) && current < lineEnd && *current == ')';
+            
+            if(isPair && first >= 0 && second >= 0)
+            {
+                ++current;
+                
+                if(NetworkFileFieldEquals(nameBegin, nameEnd, "activates"))
+                    answerSet.edges.push_back(Edge(ACTIVATES, first, second));
+                else if(NetworkFileFieldEquals(nameBegin, nameEnd, "inhibits"))
+                    answerSet.edges.push_back(Edge(INHIBITS, first, second));
+                else if(NetworkFileFieldEquals(nameBegin, nameEnd, "repairCost") && first < (int)MAX_REPAIR_RULES)
+                {
+                    if((size_t)first >= answerSet.repairCosts.size())
+                        answerSet.repairCosts.resize(first + 1, 0);
+                    
+                    answerSet.repairCosts[first] = second;
+                    ++answerSet.repairCostsNum;
+                }
+            }
+            
+            while(current < lineEnd && *current != ' ')
+                ++current;
+        }
+    }
+    
+    static bool ParseNumber(const char *&current, const char *lineEnd, int &value)
+    {
+        std::from_chars_result result = std::from_chars(current, lineEnd, value);
+        
+        if(result.ec != std::errc())
+            return false;
+        
+        current = result.ptr;
+        
+        return true;
+    }
+    
+    MappedFile file;
+    
+    const char *position;
+    const char *fileEnd;
+};
+
+// writes edges the way they appear in answer sets: "activates(1,2) inhibits(2,3) ..."
+void WriteEdgeAtoms(std::ostream &stream, const std::vector<Edge> &edges)
+{
+    for(size_t i = 0; i < edges.size(); ++i)
+    {
+        if(i > 0)
+            stream << " ";
+        
+        stream << ((edges[i].type == ACTIVATES) ? "activates(" : "inhibits(") << edges[i].from << "," << edges[i].to << ")";
+    }
+}
+
+
+// one pass over a solver output file, adding the repairCost values of every answer set to statistics
+bool AddRuleStatistics(const std::string &fileName, RuleStatistics &statistics)
+{
+    ScopedTimer timer("AddRuleStatistics", fileName);
+    
+    AnswerSetReader file;
+    
+    if(!file.Open(fileName))
+        return false;
+    
+    timer.Count("bytesRead", file.file.size);
+    
+    AnswerSet answerSet;
+    RepairCostTable table;
+    
+    while(file.Next(answerSet))
+    {
+        timer.Count("modelsParsed", 1);
+        
+        table.Add(answerSet.repairCosts);
+        
+        if(table.repairsNum == REPAIR_TABLE_CHUNK)
+        {
+            statistics.AddTable(table);
+            table.Clear();
+        }
+    }
+    
+    statistics.AddTable(table);
+    
+    return true;
+}
+
+// statistics of the repairs of several files together (e.g. a randomRepairs file split in parts), one thread per file
+bool ComputeRuleStatistics(const std::vector<std::string> &fileNames, RuleStatistics &statistics)
+{
+    ScopedTimer timer("ComputeRuleStatistics");
+    
+    std::vector<RuleStatistics> fileStatistics(fileNames.size());
+    std::vector<char> opened(fileNames.size(), 0);
+    
+    std::vector<std::thread> threads;
+    
+    for(size_t f = 0; f < fileNames.size(); ++f)
+        threads.push_back(std::thread([&, f]() { opened[f] = AddRuleStatistics(fileNames[f], fileStatistics[f]); }));
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+    
+    bool allOpened = true;
+    
+    for(size_t f = 0; f < fileNames.size(); ++f)
+    {
+        if(!opened[f])
+        {
+            std::cout << "ERROR: Unable to open repairs file " << fileNames[f] << "..\n";
+            allOpened = false;
+        }
+        
+        statistics.Merge(fileStatistics[f]);
+    }
+    
+    return allOpened;
+}
+
+
+void AnalyzeResult(const std::string &resultFileName, const std::string &outputFileName)
+{
+    ScopedTimer timer("AnalyzeResult", resultFileName);
+    
+    std::vector<Edge> originalEdges;
+    
+    if(resultFileName.find("budding") != std::string::npos)
+        originalEdges = budding.edges;
+    else if(resultFileName.find("fission") != std::string::npos)
+        originalEdges = fission.edges;
+    else if(resultFileName.find("elegans") != std::string::npos)
+        originalEdges = elegans.edges;
+    else if(resultFileName.find("mammalian") != std::string::npos)
+        originalEdges = mammalian.edges;
+    else if(resultFileName.find("arabidopsis") != std::string::npos)
+        originalEdges = arabidopsis.edges;
+    else if(resultFileName.find("synthetic") != std::string::npos)
+        originalEdges = synthetic.edges;
+    
+    // built once, so comparing a repaired edge to the original network is a single lookup
+    EdgeSet originalEdgeSet;
+    originalEdgeSet.Build(originalEdges);
+    
+    AnswerSetReader resultFile;
+    std::ofstream outputFile(outputFileName);
+    
+    AnswerSet answerSet;
+    
+    if(resultFile.Open(resultFileName) && outputFile.is_open())
+    {
+        timer.Count("bytesRead", resultFile.file.size);
+        
+        while(resultFile.Next(answerSet))
+        {
+            const std::vector<Edge> &resultEdges = answerSet.edges;
+            
+            timer.Count("modelsParsed", 1);
+            timer.Count("edgesCompared", resultEdges.size());
+            
+            outputFile << "Answer: " << answerSet.number << "\n";
+            
+            WriteEdgeAtoms(outputFile, resultEdges);
+            outputFile << "\n";
+            
+            float nbOfSimilarEdges = (float)originalEdgeSet.CountCommon(resultEdges);
+            
+            float precision = nbOfSimilarEdges / resultEdges.size();
+            float recall = nbOfSimilarEdges / originalEdges.size();
+            
+            float f1_score = 2.0 * (precision * recall) / (precision + recall);
+            
+            outputFile << "\nPrecision: " << nbOfSimilarEdges << " / " << resultEdges.size() << " = " << precision << " (Nb. of edges in repaired network that are from original network)\n";
+            outputFile << "Recall: " << nbOfSimilarEdges << " / " << originalEdges.size() << " = " << recall << " (Nb. of edges in original network, found in repaired network)\n";
+            
+            outputFile << "\nF1-score = " << f1_score << "\n";
+            
+            float jaccardIndex = (float)nbOfSimilarEdges / ((float)originalEdges.size() + (float)resultEdges.size() - (float)nbOfSimilarEdges);
+            
+            outputFile << "\nJaccard Index = " << jaccardIndex << " (Intersection of original and repaired network divided by their union)\n";
+            
+            outputFile << "\n";
+        }
+        
+        
+        resultFile.Close();
+        outputFile.close();
+    }
+    else
+    {
+        std::cout << "ERROR: Unable to open result file or create output file..\n";
+        return;
+    }
+    
+    std::cout << "\n\nFINISHED ANALYZING RESULT AND CREATING FILE!\n\n";
+}
+
+
+
+std::string GetNextIntermediateName()
+{
+    static char character = 'A';
+    static unsigned int number = 0;
+    
+    std::string intermediate;
+    
+    intermediate += character;
+    intermediate += std::to_string(number);
+    
+    ++character;
+    
+    if(character > 'Z')
+    {
+        character = 'A';
+        ++number;
+    }
+    
+    return intermediate;
+}
+
+
+// counter-based random numbers (SplitMix64 on a per-stream key): the n-th number of a stream only depends on
+// (seed, stream, n), so every corrupted instance can be generated on its own, on any thread, and always comes out the same
+struct RandomStream
+{
+    RandomStream(uint64_t Seed, uint64_t Stream)
+    {
+        key = Mix(Seed ^ Mix(Stream + GOLDEN_GAMMA));
+        counter = 0;
+    }
+    
+    static uint64_t Mix(uint64_t x)
+    {
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        
+        return x ^ (x >> 31);
+    }
+    
+    uint64_t Next()
+    {
+        return Mix(key + GOLDEN_GAMMA * ++counter);
+    }
+    
+    // uniform in [0, bound) without modulo bias (multiply-shift, rejecting the few values that would favour low results)
+    uint64_t Below(uint64_t bound)
+    {
+        unsigned __int128 product = (unsigned __int128)Next() * bound;
+        uint64_t low = (uint64_t)product;
+        
+        if(low < bound)
+        {
+            uint64_t threshold = (0 - bound) % bound;
+            
+            while(low < threshold)
+            {
+                product = (unsigned __int128)Next() * bound;
+                low = (uint64_t)product;
+            }
+        }
+        
+        return (uint64_t)(product >> 64);
+    }
+    
+    // uniform in [0, 1)
+    double Unit()
+    {
+        return (double)(Next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+    
+    static const uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+    
+    uint64_t key;
+    uint64_t counter;
+};
+
+// corrupts a network the way the hand-written CORRUPTED variants of LoadNetworks() are: removedEdgesRatio of the edges are
+// dropped and addedEdgesRatio * edges wrong edges are put in addedEdges; an added edge never links two genes that are
+// already linked in the original network (in either sign), and never appears twice
+// the removed edges are kept in removedEdges, so every instance carries its own ground truth
+// (seed, instance) picks the random stream: the same pair always gives the same corrupted network
+GeneNetwork CorruptNetwork(const GeneNetwork &geneNetwork, float addedEdgesRatio, float removedEdgesRatio, uint64_t seed = 0, uint64_t instance = 0)
+{
+    GeneNetwork corruptedNetwork;
+    
+    if(!geneNetwork.addedEdges.empty())
+    {
+        std::cout << "ERROR: Trying to corrupt a network that is already corrupted!\n";
+        return corruptedNetwork;
+    }
+    
+    corruptedNetwork.name = geneNetwork.name;
+    corruptedNetwork.timeSteps = geneNetwork.timeSteps;
+    corruptedNetwork.table = geneNetwork.table;
+    corruptedNetwork.geneNum = geneNetwork.geneNum;
+    
+    RandomStream random(seed, instance);
+    
+    size_t edgesNum = geneNetwork.edges.size();
+    size_t nbOfEdgesToRemove = std::min(edgesNum, (size_t)std::lround(edgesNum * (double)removedEdgesRatio));
+    size_t nbOfEdgesToAdd = (size_t)std::lround(edgesNum * (double)addedEdgesRatio);
+    
+    // removed edges: first nbOfEdgesToRemove positions of a partial Fisher-Yates shuffle, kept in the network's order
+    std::vector<unsigned int> order(edgesNum);
+    
+    for(size_t i = 0; i < edgesNum; ++i)
+        order[i] = (unsigned int)i;
+    
+    for(size_t i = 0; i < nbOfEdgesToRemove; ++i)
+        std::swap(order[i], order[i + random.Below(edgesNum - i)]);
+    
+    std::vector<bool> removed(edgesNum, false);
+    
+    for(size_t i = 0; i < nbOfEdgesToRemove; ++i)
+        removed[order[i]] = true;
+    
+    for(size_t i = 0; i < edgesNum; ++i)
+    {
+        if(removed[i])
+            corruptedNetwork.removedEdges.push_back(geneNetwork.edges[i]);
+        else
+            corruptedNetwork.edges.push_back(geneNetwork.edges[i]);
+    }
+    
+    // added edges: random gene pairs that are not linked yet, with a random sign
+    uint64_t side = (uint64_t)geneNetwork.geneNum + 1;
+    uint64_t pairsNum = (uint64_t)geneNetwork.geneNum * geneNetwork.geneNum;
+    
+    std::unordered_set<uint64_t> linkedPairs;
+    linkedPairs.reserve(edgesNum + nbOfEdgesToAdd);
+    
+    for(size_t i = 0; i < edgesNum; ++i)
+        linkedPairs.insert(geneNetwork.edges[i].from * side + geneNetwork.edges[i].to);
+    
+    uint64_t freePairsNum = pairsNum - linkedPairs.size();
+    
+    if(nbOfEdgesToAdd > freePairsNum)
+    {
+        std::cout << "WARNING: Only " << freePairsNum << " gene pairs are free in " << geneNetwork.name << ", can't add " << nbOfEdgesToAdd << " edges..\n";
+        nbOfEdgesToAdd = freePairsNum;
+    }
+    
+    corruptedNetwork.addedEdges.reserve(nbOfEdgesToAdd);
+    
+    if(nbOfEdgesToAdd * 2 <= freePairsNum)
+    {
+        // sparse enough for rejection sampling (each draw hits a free pair at least half of the time)
+        while(corruptedNetwork.addedEdges.size() < nbOfEdgesToAdd)
+        {
+            unsigned int from = 1 + (unsigned int)random.Below(geneNetwork.geneNum);
+            unsigned int to = 1 + (unsigned int)random.Below(geneNetwork.geneNum);
+            
+            if(!linkedPairs.insert(from * side + to).second)
+                continue;
+            
+            corruptedNetwork.addedEdges.push_back(Edge(random.Below(2) ? INHIBITS : ACTIVATES, from, to));
+        }
+    }
+    else
+    {
+        // most free pairs are needed: list them and pick with a partial Fisher-Yates shuffle
+        std::vector<uint64_t> freePairs;
+        freePairs.reserve(freePairsNum);
+        
+        for(unsigned int from = 1; from <= geneNetwork.geneNum; ++from)
+            for(unsigned int to = 1; to <= geneNetwork.geneNum; ++to)
+                if(linkedPairs.count(from * side + to) == 0)
+                    freePairs.push_back(from * side + to);
+        
+        for(size_t i = 0; i < nbOfEdgesToAdd; ++i)
+        {
+            std::swap(freePairs[i], freePairs[i + random.Below(freePairs.size() - i)]);
+            
+            corruptedNetwork.addedEdges.push_back(Edge(random.Below(2) ? INHIBITS : ACTIVATES, (unsigned int)(freePairs[i] / side), (unsigned int)(freePairs[i] % side)));
+        }
+    }
+    
+    return corruptedNetwork;
+}
+
+// writes instancesNum corrupted instances of a network to <directory>/<name>_<added>_<removed>_<instance>_*.tsv
+// (the format of SaveNetworkToFiles, with the removed edges as ground truth), instance i always being the same for a seed
+// threadsNum = 0: one thread per core
+bool CorruptNetworkInstances(const GeneNetwork &geneNetwork, float addedEdgesRatio, float removedEdgesRatio, unsigned int instancesNum, uint64_t seed, const std::string &directory, unsigned int threadsNum = 0)
+{
+    if(threadsNum == 0)
+        threadsNum = std::thread::hardware_concurrency();
+    
+    threadsNum = std::max(1u, std::min(threadsNum, instancesNum));
+    
+    std::string prefix = geneNetwork.name + "_" + std::to_string(std::lround(addedEdgesRatio * 100)) + "_" + std::to_string(std::lround(removedEdgesRatio * 100)) + "_";
+    
+    std::atomic<unsigned int> nextInstance(0);
+    std::atomic<bool> succeeded(true);
+    std::vector<std::thread> threads;
+    
+    for(unsigned int t = 0; t < threadsNum; ++t)
+    {
+        threads.push_back(std::thread([&]()
+        {
+            unsigned int instance;
+            while((instance = nextInstance++) < instancesNum && succeeded)
+            {
+                GeneNetwork corruptedNetwork = CorruptNetwork(geneNetwork, addedEdgesRatio, removedEdgesRatio, seed, instance);
+                corruptedNetwork.name = prefix + std::to_string(instance);
+                
+                if(!SaveNetworkToFiles(corruptedNetwork, directory))
+                    succeeded = false;
+            }
+        }));
+    }
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+    
+    if(succeeded)
+        std::cout << "\n\nFINISHED WRITING " << instancesNum << " CORRUPTED INSTANCES OF " << geneNetwork.name << "!\n\n";
+    
+    return succeeded;
+}
+
+
+
+enum NETWORK_TOPOLOGY
+{
+    ERDOS_RENYI = 0,    // every pair of genes equally likely
+    SCALE_FREE,         // preferential attachment: genes are added one by one and link to genes in proportion to their degree
+};
+
+// synthetic network for scaling runs: geneNum genes, round(edgesNodesRatio * geneNum) signed edges and a timeseries table
+// simulated with CreateASPfile's update rule (BooleanNetworkSimulator) from a random initial state, so the network and
+// its table are consistent (corrupt it with CorruptNetwork to get something to repair)
+// - kDegree, as measured by LearnProperties, is 2 * edgesNodesRatio (every edge adds to the degree of both its genes)
+// - targetDiameter (ERDOS_RENYI only, 0: no target): genes sit on a ring and only link to genes within
+//   about geneNum / (2 * targetDiameter) positions, which gives roughly that diameter once there are a few edges per gene
+//   (SCALE_FREE networks have the small diameter of their hubs)
+// - inhibitsRatio of the edges inhibit, the others activate; a pair of genes is never linked twice
+// (seed) always gives the same network
+bool GenerateSyntheticNetwork(GeneNetwork &geneNetwork, const std::string &name, int topology, unsigned int geneNum, float edgesNodesRatio, unsigned int timeSteps, uint64_t seed, unsigned int targetDiameter = 0, float inhibitsRatio = 0.5f)
+{
+    geneNetwork.Clear();
+    
+    geneNetwork.name = name;
+    geneNetwork.geneNum = geneNum;
+    geneNetwork.timeSteps = timeSteps;
+    
+    size_t edgesNum = (size_t)std::lround(edgesNodesRatio * (double)geneNum);
+    
+    // ring positions a gene can link to (itself included)
+    uint64_t window = geneNum;
+    
+    // a gene only has about edgesNodesRatio neighbours on each side, and the farthest of k random ones within the
+    // window is k / (k + 1) of the way to its end, so the window is widened by (k + 1) / k for hops to span it
+    if(topology == ERDOS_RENYI && targetDiameter > 0)
+    {
+        double neighboursNum = std::max(1.0, (double)edgesNodesRatio);
+        
+        window = std::max((uint64_t)1, (uint64_t)std::ceil(geneNum / (2.0 * targetDiameter) * (neighboursNum + 1) / neighboursNum));
+    }
+    
+    uint64_t pairsNum = (window * 2 + 1 < geneNum) ? (uint64_t)geneNum * (window * 2 + 1) : (uint64_t)geneNum * geneNum;
+    
+    if(geneNum == 0 || edgesNum > pairsNum)
+    {
+        std::cout << "ERROR: Can't put " << edgesNum << " edges on " << geneNum << " genes..\n";
+        return false;
+    }
+    
+    RandomStream random(seed, 0);
+    
+    uint64_t side = (uint64_t)geneNum + 1;
+    
+    std::unordered_set<uint64_t> linkedPairs;
+    linkedPairs.reserve(edgesNum);
+    
+    geneNetwork.edges.reserve(edgesNum);
+    
+    auto AddEdge = [&](unsigned int from, unsigned int to)
+    {
+        if(!linkedPairs.insert(from * side + to).second)
+            return false;
+        
+        geneNetwork.edges.push_back(Edge(random.Unit() < inhibitsRatio ? INHIBITS : ACTIVATES, from, to));
+        
+        return true;
+    };
+    
+    if(topology == SCALE_FREE)
+    {
+        // every gene once, plus both genes of every edge: a uniform pick from it is a pick in proportion to degree + 1
+        std::vector<unsigned int> endpoints;
+        endpoints.reserve(geneNum + 2 * edgesNum);
+        
+        endpoints.push_back(1);
+        
+        // edges that couldn't be placed yet (the first genes have few genes to link to)
+        size_t pendingEdgesNum = (geneNum == 1) ? edgesNum : 0;
+        
+        for(unsigned int gene = 2; gene <= geneNum; ++gene)
+        {
+            pendingEdgesNum += (size_t)((uint64_t)edgesNum * (gene - 1) / (geneNum - 1) - (uint64_t)edgesNum * (gene - 2) / (geneNum - 1));
+            
+            size_t attemptsNum = 8 * pendingEdgesNum;
+            
+            for(size_t attempt = 0; attempt < attemptsNum && pendingEdgesNum > 0; ++attempt)
+            {
+                unsigned int target = endpoints[random.Below(endpoints.size())];
+                
+                bool added = random.Below(2) ? AddEdge(gene, target) : AddEdge(target, gene);
+                
+                if(added)
+                {
+                    endpoints.push_back(gene);
+                    endpoints.push_back(target);
+                    --pendingEdgesNum;
+                }
+            }
+            
+            endpoints.push_back(gene);
+        }
+        
+        // what is left goes between two genes picked by degree
+        while(pendingEdgesNum > 0)
+        {
+            unsigned int from = endpoints[random.Below(endpoints.size())];
+            unsigned int to = endpoints[random.Below(endpoints.size())];
+            
+            if(AddEdge(from, to))
+                --pendingEdgesNum;
+        }
+    }
+    else
+    {
+        while(geneNetwork.edges.size() < edgesNum)
+        {
+            unsigned int from = 1 + (unsigned int)random.Below(geneNum);
+            unsigned int to = 1 + (unsigned int)random.Below(geneNum);
+            
+            if(window * 2 + 1 < geneNum)
+                to = 1 + (unsigned int)((from - 1 + geneNum - window + random.Below(window * 2 + 1)) % geneNum);
+            
+            AddEdge(from, to);
+        }
+    }
+    
+    // timeseries: random state at time 1, then one synchronous step per time step
+    BooleanNetworkSimulator simulator;
+    simulator.Build(geneNum, geneNetwork.edges);
+    
+    size_t wordsPerRow = simulator.wordsPerRow;
+    
+    std::vector<uint64_t> active(wordsPerRow, 0);
+    std::vector<uint64_t> inactive(wordsPerRow, 0);
+    std::vector<uint64_t> nextActive(wordsPerRow);
+    std::vector<uint64_t> nextInactive(wordsPerRow);
+    std::vector<uint64_t> receivesActivation(wordsPerRow);
+    std::vector<uint64_t> receivesInhibition(wordsPerRow);
+    
+    for(unsigned int gene = 1; gene <= geneNum; ++gene)
+    {
+        uint64_t &row = random.Below(2) ? active[(gene - 1) / 64] : inactive[(gene - 1) / 64];
+        row |= (uint64_t)1 << ((gene - 1) % 64);
+    }
+    
+    geneNetwork.table.reserve((size_t)geneNum * timeSteps);
+    
+    for(unsigned int time = 1; time <= timeSteps; ++time)
+    {
+        if(time > 1)
+        {
+            simulator.Step(active.data(), inactive.data(), nextActive.data(), nextInactive.data(), receivesActivation.data(), receivesInhibition.data());
+            
+            active.swap(nextActive);
+            inactive.swap(nextInactive);
+        }
+        
+        for(unsigned int gene = 1; gene <= geneNum; ++gene)
+        {
+            bool isActive = (active[(gene - 1) / 64] >> ((gene - 1) % 64)) & 1;
+            
+            geneNetwork.table.push_back(TableElement(isActive ? ACTIVE : INACTIVE, gene, time));
+        }
+    }
+    
+    std::cout << "\n\nFINISHED GENERATING " << name << " NETWORK (" << geneNum << " genes, " << geneNetwork.edges.size() << " edges)!\n\n";
+    
+    return true;
+}
+
+
+
+// output buffer of CreateASPfile: text goes into one preallocated block and integers are formatted with to_chars,
+// the block is written to the file in one call whenever it fills up (and on Close), so ASP files with millions of
+// table cells aren't bound by ofstream's per-call overhead
+// only string literals, std::string and integers can be written, which is everything an ASP file is made of
+const size_t ASP_WRITER_BUFFER_SIZE = (size_t)1 << 24;
+
+struct AspWriter
+{
+    AspWriter(const std::string &fileName, size_t bufferSize = ASP_WRITER_BUFFER_SIZE) : file(fileName, std::ios::binary)
+    {
+        buffer.resize(std::max(bufferSize, (size_t)64));
+        used = 0;
+        written = 0;
+    }
+
+    ~AspWriter()
+    {
+        Close();
+    }
+
+    bool is_open() const
+    {
+        return file.is_open();
+    }
+
+    // makes sure the next "bytes" bytes fit without a write, so a whole section can be built in place and written at once
+    // (never grows past 4 times the initial size, bigger sections are written in several blocks)
+    void Reserve(size_t bytes)
+    {
+        size_t maxSize = std::max(buffer.size(), 4 * ASP_WRITER_BUFFER_SIZE);
+
+        if(bytes > buffer.size() - used)
+        {
+            Flush();
+
+            if(bytes > buffer.size())
+                buffer.resize(std::min(bytes, maxSize));
+        }
+    }
+
+    void Append(const char *text, size_t length)
+    {
+        if(length > buffer.size() - used)
+        {
+            Flush();
+
+            if(length > buffer.size())
+            {
+                file.write(text, length);
+                written += length;
+                return;
+            }
+        }
+
+        memcpy(&buffer[used], text, length);
+        used += length;
+    }
+
+    // string literals: the length is known at compile time, no strlen
+    template <size_t N>
+    AspWriter &operator<<(const char (&text)[N])
+    {
+        Append(text, N - 1);
+        return *this;
+    }
+
+    AspWriter &operator<<(const std::string &text)
+    {
+        Append(text.data(), text.size());
+        return *this;
+    }
+
+    AspWriter &operator<<(char character)
+    {
+        Append(&character, 1);
+        return *this;
+    }
+
+    template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    AspWriter &operator<<(T value)
+    {
+        // 20 digits and a sign cover every 64-bit integer
+        if(buffer.size() - used < 24)
+            Flush();
+
+        used = std::to_chars(&buffer[used], &buffer[used] + 24, value).ptr - &buffer[0];
+        return *this;
+    }
+
+    void Flush()
+    {
+        if(used > 0)
+        {
+            file.write(buffer.data(), used);
+            written += used;
+            used = 0;
+        }
+    }
+
+    // bytes written so far, including what is still in the buffer
+    uint64_t tellp() const
+    {
+        return written + used;
+    }
+
+    bool Close()
+    {
+        if(!file.is_open())
+            return false;
+
+        Flush();
+        file.close();
+
+        return !file.fail();
+    }
+
+    std::ofstream file;
+    std::vector<char> buffer;
+    size_t used;
+    uint64_t written;
+};
+
+
+
+// pruneCandidateEdges: only let the solver add edges that could explain at least one observed cell (see FindCandidateEdges)
+// this keeps every minimal repair, but rules of thumb that favour extra edges can't pick pruned edges anymore
+// clingoSyntax: write the aggregates, #minimize and #show statements in clingo 4+ syntax (for the clingo library, see
+// ElieRankingInProcess) instead of gringo 3 syntax; both programs have the same answer sets
+void CreateASPfile(const GeneNetwork &geneNetwork, const std::string &fileName, bool rulesOfThumb = false, bool pruneCandidateEdges = false, bool clingoSyntax = false)
+{
+    ScopedTimer timer("CreateASPfile", fileName);
+    
+    AspWriter file(fileName);
+    
+    if(file.is_open())
+    {
+        file << "% genes (nodes) of " << geneNetwork.name << " network\n";
+        
+        for(size_t i = 1; i <= geneNetwork.geneNum; ++i)
+            file << "gene(" << i << ").\n";
+        
+        file << "\n% time steps\n";
+        
+        for(size_t i = 1; i <= geneNetwork.timeSteps; ++i)
+            file << "time(" << i << ").\n";
+        
+        file << "\n% edges between genes\n";
+        file << "% " << geneNetwork.edges.size() << " initial edges\n";
+        
+        size_t edgesNum = geneNetwork.edges.size();
+        
+        // longest line: "edge(" + 2 x 10 digits + ",-1).\n"
+        file.Reserve((edgesNum + geneNetwork.addedEdges.size()) * 32);
+        
+        for(size_t currentEdge = 0; currentEdge < edgesNum; ++currentEdge)
+        {
+            if(geneNetwork.edges[currentEdge].type == EDGE_TYPE::ACTIVATES)
+            {
+                file << "edge(" << geneNetwork.edges[currentEdge].from << "," << geneNetwork.edges[currentEdge].to << ",1).\n";
+            }
+            
+            if(geneNetwork.edges[currentEdge].type == EDGE_TYPE::INHIBITS)
+            {
+                file << "edge(" << geneNetwork.edges[currentEdge].from << "," << geneNetwork.edges[currentEdge].to << ",-1).\n";
+            }
+        }
+        
+        file << "\n% " << geneNetwork.addedEdges.size() << " added edges\n";
+        
+        if(geneNetwork.addedEdges.empty())
+            std::cout << "\nWARNING: There are no added edges to corrupt the original network..\n\n";
+        
+        size_t addedEdgesNum = geneNetwork.addedEdges.size();
+        for(size_t currentEdge = 0; currentEdge < addedEdgesNum; ++currentEdge)
+        {
+            if(geneNetwork.addedEdges[currentEdge].type == EDGE_TYPE::ACTIVATES)
+            {
+                file << "edge(" << geneNetwork.addedEdges[currentEdge].from << "," << geneNetwork.addedEdges[currentEdge].to << ",1).\n";
+            }
+            
+            if(geneNetwork.addedEdges[currentEdge].type == EDGE_TYPE::INHIBITS)
+            {
+                file << "edge(" << geneNetwork.addedEdges[currentEdge].from << "," << geneNetwork.addedEdges[currentEdge].to << ",-1).\n";
+            }
+        }
+        
+        file << "\nedge(U,V) :- edge(U,V,S).\n";
+        
+        
+        if(pruneCandidateEdges)
+        {
+            std::vector<Edge> candidateEdges;
+            size_t possibleAdditions = FindCandidateEdges(geneNetwork, candidateEdges);
+            
+            size_t candidateActivations = 0;
+            
+            for(size_t i = 0; i < candidateEdges.size(); ++i)
+                candidateActivations += (candidateEdges[i].type == ACTIVATES);
+            
+            size_t candidateInhibitions = candidateEdges.size() - candidateActivations;
+            
+            file << "\n% candidate additions: edges that could explain at least one observed cell of the table\n";
+            file << "% " << candidateActivations << " of " << possibleAdditions << " activations, " << candidateInhibitions << " of " << possibleAdditions << " inhibitions\n";
+            
+            for(size_t i = 0; i < candidateEdges.size(); ++i)
+            {
+                if(candidateEdges[i].type == ACTIVATES)
+                    file << "candidateAct(" << candidateEdges[i].from << "," << candidateEdges[i].to << ").\n";
+                else
+                    file << "candidateInh(" << candidateEdges[i].from << "," << candidateEdges[i].to << ").\n";
+            }
+            
+            std::cout << "\nCandidate edges: " << candidateActivations << " of " << possibleAdditions << " activations and " << candidateInhibitions << " of " << possibleAdditions << " inhibitions kept";
+            
+            if(possibleAdditions > 0)
+                std::cout << " (" << std::setprecision(3) << 100.0 * (1.0 - (double)candidateEdges.size() / (2.0 * possibleAdditions)) << "% pruned)";
+            
+            std::cout << "\n";
+            
+            file << "\n% either add an activation edge, or an inhibition either, or nothing\n";
+            file << "% this also doesn't allow the addition of both between a pair of nodes\n";
+            file << "addActEdge(U,V) :- candidateAct(U,V), not edge(U,V), not addInhEdge(U,V), not nAddActEdge(U,V).\n";
+            file << "nAddActEdge(U,V) :- candidateAct(U,V), not edge(U,V), not addInhEdge(U,V), not addActEdge(U,V).\n";
+            
+            file << "\naddInhEdge(U,V) :- candidateInh(U,V), not edge(U,V), not addActEdge(U,V), not nAddInhEdge(U,V).\n";
+            file << "nAddInhEdge(U,V) :- candidateInh(U,V), not edge(U,V), not addActEdge(U,V), not addInhEdge(U,V).\n";
+        }
+        else
+        {
+            file << "\n% either add an activation edge, or an inhibition either, or nothing\n";
+            file << "% this also doesn't allow the addition of both between a pair of nodes\n";
+            file << "addActEdge(U,V) :- gene(U), gene(V), not edge(U,V), not addInhEdge(U,V), not nAddActEdge(U,V).\n";
+            file << "nAddActEdge(U,V) :- gene(U), gene(V), not edge(U,V), not addInhEdge(U,V), not addActEdge(U,V).\n";
+            
+            file << "\naddInhEdge(U,V) :- gene(U), gene(V), not edge(U,V), not addActEdge(U,V), not nAddInhEdge(U,V).\n";
+            file << "nAddInhEdge(U,V) :- gene(U), gene(V), not edge(U,V), not addActEdge(U,V), not addInhEdge(U,V).\n";
+        }
+        
+        file << "\n% either remove or don't remove existing edges\n";
+        file << "removeEdge(U,V,S) :- edge(U,V,S), not nRemoveEdge(U,V,S).\n";
+        file << "nRemoveEdge(U,V,S) :- edge(U,V,S), not removeEdge(U,V,S).\n";
+        
+        
+        file << "\n% generate activates(U,V) and inhibits(U,V) to check consistency between graph and table\n";
+        file << "activates(U,V) :- edge(U,V,1), not removeEdge(U,V,1).\n";
+        file << "activates(U,V) :- addActEdge(U,V).\n";
+        
+        file << "\ninhibits(U,V) :- edge(U,V,-1), not removeEdge(U,V,-1).\n";
+        file << "inhibits(U,V) :- addInhEdge(U,V).\n";
+        
+        file << "\n% a gene either activates or inhibits another gene\n";
+        file << "% (this will make sure we don't add an activation edge and an inhibition edge at the same\n";
+        file << "% time between two genes)\n";
+        file << " :- activates(X,Y), inhibits(X,Y).\n";
+        
+        file << "\n% literals to count added edges all together\n";
+        file << "% (I keep the signs so I can quickly see what is being added in answer sets)\n";
+        file << "addEdge(U,V,1) :- addActEdge(U,V).\n";
+        file << "addEdge(U,V,-1) :- addInhEdge(U,V).\n";
+        
+        file << "\n% compute cost of adding and removing edges\n";
+        if(clingoSyntax)
+            file << "costAdding(X) :- X = #count{U,V,S : addEdge(U,V,S)}.\n";
+        else
+            file << "costAdding(X) :- X = #count{addEdge(U,V,_)}.\n";
+        if(clingoSyntax)
+            file << "costRemoving(Y) :- Y = #count{U,V,S : removeEdge(U,V,S)}.\n";
+        else
+            file << "costRemoving(Y) :- Y = #count{removeEdge(U,V,_)}.\n";
+        
+        file << "\nrepairCost(0,Z) :- costAdding(X), costRemoving(Y), Z=X+Y.\n";
+        
+        
+        file << "\n";
+        file << "% observations at different time steps\n\n";
+        file << "% timeseries table\n";
+        
+        size_t tableSize = geneNetwork.table.size();
+        
+        // longest line: "inactive(" + 2 x 10 digits + ").\n"
+        file.Reserve(tableSize * 33);
+        
+        for(size_t i = 0; i < tableSize; ++i)
+        {
+            if(geneNetwork.table[i].type == TABLE_TYPE::ACTIVE)
+            {
+                file << "active(" << geneNetwork.table[i].gene << "," << geneNetwork.table[i].time << ").\n";
+            }
+            
+            if(geneNetwork.table[i].type == TABLE_TYPE::INACTIVE)
+            {
+                file << "inactive(" << geneNetwork.table[i].gene << "," << geneNetwork.table[i].time << ").\n";
+            }
+        }
+        
+        
+        file << "\n% activation and inhibition rules\n";
+        
+        file << "\n% Y receives activation at time T if X activates Y and X is active at time T\n";
+        file << "receivesActivation(Y,T) :- activates(X,Y), active(X,T).\n";
+        
+        file << "\n% Y receives inhibition at time T if X inhibits Y and X is active at time T\n";
+        file << "receivesInhibition(Y,T) :- inhibits(X,Y), active(X,T).\n";
+        
+        file << "\n% determine whether a gene is activated or inhibited (or none) at each time step\n";
+        file << "activated(Y,T) :- receivesActivation(Y,T-1), not receivesInhibition(Y,T-1), time(T).\n";
+        
+        file << "\ninhibited(Y,T) :- receivesInhibition(Y,T-1), not receivesActivation(Y,T-1), time(T).\n";
+        
+        file << "\n% this may not be needed, but it's a sanity check\n";
+        file << " :- activated(Y,T), inhibited(Y,T).\n";
+        
+        file << "\n% check consistency between graph and observations table\n";
+        
+        file << "\n% generate active and inactive for all genes based on graph propagation update\n";
+        
+        file << "\n% Y is inactive at time T if it was active at time T-1 and was inhibited at time T\n";
+        file << "inactive(Y,T) :- active(Y,T-1), inhibited(Y,T), time(T).\n";
+        
+        file << "\n% Y is active at time T if it was active at time T-1 and wasn't inhibited at time T\n";
+        file << "active(Y,T) :- active(Y,T-1), not inhibited(Y,T), time(T).\n";
+        
+        file << "\n% Y is active at time T if it was inactive at time T-1 and was activated at time T\n";
+        file << "active(Y,T) :- inactive(Y,T-1), activated(Y,T), time(T).\n";
+        
+        file << "\n% Y is inactive at time T if it was inactive at time T-1 and wasn't activated at time T\n";
+        file << "inactive(Y,T) :- inactive(Y,T-1), not activated(Y,T), time(T).\n";
+        
+        
+        file << "\n% consistency check: make sure the data generated by the graph doesn't create conflicts\n";
+        file << "% with the data in the table\n";
+        file << " :- active(Y,T), inactive(Y,T).\n";
+        
+        if(rulesOfThumb)
+        {
+            
+            unsigned int timeSteps = geneNetwork.timeSteps;
+            unsigned int timeStepsPlus1 = timeSteps + 1;
+            size_t totalEdgesNum = geneNetwork.edges.size() + geneNetwork.addedEdges.size();
+            
+            file << "\n\nedgeAfterRepair(U,V) :- activates(U,V).\n";
+            file << "edgeAfterRepair(U,V) :- inhibits(U,V).";
+            
+            
+            // ***********************************************************
+            // RULE OF THUMB Nb. 1 => last time-step should be fixed state
+            // ***********************************************************
+            file << "\n\n% RULE OF THUMB Nb. 1 => last time-step should be fixed state\n";
+            
+            for(size_t i = 0; i < tableSize; ++i)
+            {
+                if(geneNetwork.table[i].time == geneNetwork.timeSteps)
+                {
+                    if(geneNetwork.table[i].type == TABLE_TYPE::ACTIVE)
+                        file << "activePlus(" << geneNetwork.table[i].gene << "," << timeStepsPlus1 << ").\n";
+                    
+                    if(geneNetwork.table[i].type == TABLE_TYPE::INACTIVE)
+                        file << "inactivePlus(" << geneNetwork.table[i].gene << "," << timeStepsPlus1 << ").\n";
+                }
+            }
+            
+            file << "\nactivated(Y," << timeStepsPlus1 << ") :- receivesActivation(Y," << timeSteps << "), not receivesInhibition(Y," << timeSteps << ").\n";
+            file << "inhibited(Y," << timeStepsPlus1 << ") :- receivesInhibition(Y," << timeSteps << "), not receivesActivation(Y," << timeSteps << ").\n";
+            
+            file << "\nisInactivePlus(Y," << timeStepsPlus1 << ") :- active(Y," << timeSteps << "), inhibited(Y," << timeStepsPlus1 << ").\n";
+            file << "isActivePlus(Y," << timeStepsPlus1 << ") :- active(Y," << timeSteps << "), not inhibited(Y," << timeStepsPlus1 << ").\n";
+            file << "isActivePlus(Y," << timeStepsPlus1 << ") :- inactive(Y," << timeSteps << "), activated(Y," << timeStepsPlus1 << ").\n";
+            file << "isInactivePlus(Y," << timeStepsPlus1 << ") :- inactive(Y," << timeSteps << "), not activated(Y," << timeStepsPlus1 << ").\n";
+            
+            file << "\n :- isActivePlus(Y," << timeStepsPlus1 << "), isInactivePlus(Y," << timeStepsPlus1 << ").\n";
+            
+            file << "\npenalty(1) :- activePlus(Y," << timeStepsPlus1 << "), isInactivePlus(Y," << timeStepsPlus1 << ").\n";
+            file << "penalty(1) :- inactivePlus(Y," << timeStepsPlus1 << "), isActivePlus(Y," << timeStepsPlus1 << ").\n";
+            
+            file << "\npenalty(1) :- activePlus(Y," << timeStepsPlus1 << "), not isActivePlus(Y," << timeStepsPlus1 << ").\n";
+            file << "penalty(1) :- inactivePlus(Y," << timeStepsPlus1 << "), not isInactivePlus(Y," << timeStepsPlus1 << ").\n";
+            file << "penalty(1) :- not activePlus(Y," << timeStepsPlus1 << "), isActivePlus(Y," << timeStepsPlus1 << ").\n";
+            file << "penalty(1) :- not inactivePlus(Y," << timeStepsPlus1 << "), isInactivePlus(Y," << timeStepsPlus1 << ").\n";
+            
+            file << "\nrepairCost(1," << totalEdgesNum << ") :- penalty(1).\n";
+            file << "repairCost(1,0) :- not penalty(1).\n";
+            
+            
+            // *********************************************************************************
+            // RULE OF THUMB Nb. 2 => limit the number of incoming and outgoing edges for a node
+            // *********************************************************************************
+            file << "\n\n% RULE OF THUMB Nb. 2 => limit the number of ingoing and outgoing edges for a node\n";
+            if(clingoSyntax)
+            {
+                file << "kOut(C,X) :- X = #count{D : edgeAfterRepair(C,D)}, gene(C).\n";
+                file << "kIn(C,X) :- X = #count{D : edgeAfterRepair(D,C)}, gene(C).\n";
+            }
+            else
+            {
+                file << "kOut(C,X) :- X = #count{edgeAfterRepair(C,D)}, gene(C).\n";
+                file << "kIn(C,X) :- X = #count{edgeAfterRepair(D,C)}, gene(C).\n";
+            }
+            
+            file << "\nkDegree(C,Z) :- kIn(C,X), kOut(C,Y), Z=X+Y.\n";
+            
+            file << "\nkBadGene(C) :- kDegree(C,Z), Z < 4.\n";
+            file << "kBadGene(C) :- kDegree(C,Z), Z > 6.\n";
+            
+            if(clingoSyntax)
+                file << "\nkBadGenes(X) :- X = #count{C : kBadGene(C)}.\n";
+            else
+                file << "\nkBadGenes(X) :- X = #count{kBadGene(C)}.\n";
+            
+            file << "\nrepairCost(2,Y) :- kBadGenes(X), Y=X*" << (totalEdgesNum / geneNetwork.geneNum) << ".\n";
+            
+            
+            // ***********************************************************************
+            // RULE OF THUMB Nb. 3 => control the number of total edges in the network
+            // ***********************************************************************
+            file << "\n\n% RULE OF THUMB Nb. 3 => control the number of total edges in the network\n";
+            if(clingoSyntax)
+                file << "nbOfEdges(X) :- X = #count{C,D : edgeAfterRepair(C,D)}.\n";
+            else
+                file << "nbOfEdges(X) :- X = #count{edgeAfterRepair(C,D)}.\n";
+            
+            file << "\nrepairCost(3," << totalEdgesNum << "):- nbOfEdges(X), X < 21.\n";
+            file << "repairCost(3," << totalEdgesNum << ") :- nbOfEdges(X), X > 25.\n";
+            file << "repairCost(3,0) :- nbOfEdges(X), X >= 21, X <= 25.\n";
+            
+            
+            // *******************************************************************************
+            // RULE OF THUMB Nb. 4 => more likely interactions based on state of gene in table
+            // *******************************************************************************
+            file << "\n\n% RULE OF THUMB Nb. 4 => more likely interactions based on state of gene in table\n";
+            
+            unsigned int halfTime = geneNetwork.timeSteps / 2;
+            
+            file << "likelyActivator(C) :- active(C,T), T <= " << halfTime << ".\n";
+            file << "likelyInhibitor(C) :- active(C,T), T > " << halfTime << ".\n";
+            
+            file << "\nlikelyWrongEdge(C,D) :- likelyActivator(C), inhibits(C,D), not likelyInhibitor(C), C != D.\n";
+            file << "likelyWrongEdge(C,D) :- likelyInhibitor(C), activates(C,D), not likelyActivator(C), C != D.\n";
+            
+            if(clingoSyntax)
+                file << "\nlikelyWrongEdges(X) :- X = #count{C,D : likelyWrongEdge(C,D)}.\n";
+            else
+                file << "\nlikelyWrongEdges(X) :- X = #count{likelyWrongEdge(C,D)}.\n";
+            
+            file << "\nrepairCost(4,X) :- likelyWrongEdges(Y), X=Y*1.\n";
+            
+            
+            // ***************************************************************
+            // RULE OF THUMB Nb. 5 => control over the diameter of the network
+            // ***************************************************************
+            
+            file << "\n\n% RULE OF THUMB Nb. 5 => control over the diameter of the network\n";
+            file << "% first make sure every gene can be reachable\n";
+            file << "link(X,Y) :- edgeAfterRepair(X,Y), X != Y.\n";
+            file << "link(Y,X) :- edgeAfterRepair(X,Y), Y != X.\n";
+            
+            file << "\nreachable(X) :- link(1,X).\n";
+            file << "reachable(Y) :- reachable(X), link(X,Y).\n";
+            
+            file << "\n:- gene(X), not reachable(X).\n";
+            
+            file << "\n% calculate diameter:\n";
+            file << "% find shortest distance between every pair of vertices\n";
+            file << "% diameter is the greatest value between these distances\n";
+            
+            for(size_t i = 0; i < 4; ++i)
+            {
+                file << "dist(X,Y," << (i+1) << ") :- link(X,";
+                
+                
+                
+                for(size_t j = 0; j < i; ++j)
+                {
+                    std::string intermediate = GetNextIntermediateName();
+                    
+                    file << intermediate << "), link(" << intermediate << ",";
+                }
+                
+                file << "Y), X != Y.\n";
+            }
+            
+            if(clingoSyntax)
+                file << "\nsmallestDist(X,Y,D) :- D = #min{C : dist(X,Y,C)}, dist(X,Y,Z).\n";
+            else
+                file << "\nsmallestDist(X,Y,D) :- D = #min[dist(X,Y,C)=C], dist(X,Y,Z).\n";
+            
+            if(clingoSyntax)
+                file << "\ndiameter(D) :- D = #max{C : smallestDist(X,Y,C)}.\n";
+            else
+                file << "\ndiameter(D) :- D = #max[smallestDist(X,Y,C)=C].\n";
+            
+            file << "\nrepairCost(5," << totalEdgesNum << ") :- diameter(D), D < 3.\n";
+            file << "repairCost(5," << totalEdgesNum << ") :- diameter(D), D > 4.\n";
+            file << "repairCost(5,0) :- diameter(D), D >= 3, D <= 4.\n";
+            
+            
+            // **********************************************
+            // RULE OF THUMB Nb. 6 => similar dominant motifs
+            // **********************************************
+            
+            file << "\n\n% RULE OF THUMB Nb. 6 => similar dominant motifs\n";
+            
+            if(geneNetwork.geneNum > MOTIF_RULES_MAX_GENES)
+            {
+                // edge(X,Y) only depends on the input edges, so the motif count is known before grounding;
+                // grounding the motif3 rules is O(genes^3), compute the count natively instead
+                std::vector<Edge> inputEdges(geneNetwork.edges);
+                inputEdges.insert(inputEdges.end(), geneNetwork.addedEdges.begin(), geneNetwork.addedEdges.end());
+                
+                AdjacencyIndex inputAdjacency;
+                inputAdjacency.Build(geneNetwork.geneNum, inputEdges);
+                
+                std::vector<uint64_t> motifCounts;
+                ComputeTriadCensus(inputAdjacency, motifCounts);
+                
+                file << "\n% motif3 atoms counted natively (" << geneNetwork.geneNum << " genes)\n";
+                file << "dominantMotifs3(" << CountDominantMotifs(motifCounts) << ").\n";
+            }
+            else
+            {
+                file << "\nmotif3(1,X,Y,Z) :- edge(X,Y), not edge(Y,X), edge(X,Z), not edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "motif3(2,X,Y,Z) :- not edge(X,Y), edge(Y,X), edge(X,Z), not edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "motif3(3,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), not edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "motif3(4,X,Y,Z) :- not edge(X,Y), not edge(Y,X), edge(X,Z), not edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "motif3(5,X,Y,Z) :- edge(X,Y), not edge(Y,X), edge(X,Z), not edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "motif3(6,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), not edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "motif3(7,X,Y,Z) :- edge(X,Y), edge(Y,X), not edge(X,Z), edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "%motif3(8,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "%motif3(9,X,Y,Z) :- edge(X,Y), not edge(Y,X), not edge(X,Z), edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "motif3(10,X,Y,Z) :- edge(X,Y), not edge(Y,X), edge(X,Z), edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "motif3(11,X,Y,Z) :- not edge(X,Y), edge(Y,X), edge(X,Z), edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "motif3(12,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                file << "%motif3(13,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), edge(Z,X), edge(Y,Z), edge(Z,Y), X != Y, Y != Z, X != Z.\n";
+                
+                if(clingoSyntax)
+                    file << "\ndominantMotifs3(D) :- D = #count{I,X,Y,Z : motif3(I,X,Y,Z)}.\n";
+                else
+                    file << "\ndominantMotifs3(D) :- D = #count{motif3(I,X,Y,Z)}.\n";
+            }
+            
+            file << "\npenaltyMotifs(C) :- dominantMotifs3(Z), C=" << totalEdgesNum << "-Z.\n";
+            
+            file << "\nrepairCost(6,C) :- penaltyMotifs(C), C > 0.\n";
+            file << "repairCost(6,0) :- penaltyMotifs(C), C <= 0.\n";
+            
+            
+            
+            
+            // *********************
+            // END OF RULES OF THUMB
+            // *********************
+            
+        }
+        
+        
+        file << "\n\n\n";
+        
+        if(rulesOfThumb)
+        {
+            file << "%totalCost(C) :- repairCost(0,C).\n";
+            file << "%totalCost(C) :- repairCost(1,C).\n";
+            file << "%totalCost(C) :- repairCost(2,C).\n";
+            file << "%totalCost(C) :- repairCost(3,C).\n";
+            file << "%totalCost(C) :- repairCost(4,C).\n";
+            file << "%totalCost(C) :- repairCost(5,C).\n";
+            file << "%totalCost(C) :- repairCost(6,C).\n";
+        }
+        
+        if(clingoSyntax)
+            file << "totalCost(C) :- C = #sum{X,R : repairCost(R,X)}.\n";
+        else
+            file << "totalCost(C) :- C = #sum[repairCost(_,X)=X].\n";
+        
+        
+        file << "\n% minimize the number of applied repairs to the network graph\n";
+        
+        if(clingoSyntax)
+        {
+            // no #hide in clingo: once there is a #show statement, only shown atoms are printed
+            file << "#minimize{C : totalCost(C)}.\n";
+            
+            file << "\n%#show add/3.\n";
+            file << "%#show remove/3.\n";
+            file << "#show activates/2.\n";
+            file << "#show inhibits/2.\n";
+            file << "%#show repairCost/2.\n";
+            file << "%#show totalCost/1.\n";
+        }
+        else
+        {
+            file << "#minimize[totalCost(C)=C].\n";
+            
+            file << "\n#hide.\n";
+            file << "%#show add(U,V,S).\n";
+            file << "%#show remove(U,V,S).\n";
+            file << "#show activates(X,Y).\n";
+            file << "#show inhibits(X,Y).\n";
+            file << "%#show repairCost(R,X).\n";
+            file << "%#show totalCost(X).\n";
+        }
+        
+        timer.Count("bytesWritten", file.tellp());
+        
+        if(!file.Close())
+        {
+            std::cout << "ERROR: Unable to write ASP file..\n";
+            return;
+        }
+    }
+    else
+    {
+        std::cout << "ERROR: Unable to create ASP file..\n";
+        return;
+    }
+    
+    std::cout << "\n\nFINISHED CREATING ASP FILE!\n\n";
+}
+
+
+
+void StatisticalApproachWithSignificance(const std::string &randomRepairsFileName, const std::string &outputFileName)
+{
+    ScopedTimer timer("StatisticalApproachWithSignificance", randomRepairsFileName);
+    
+    std::vector<Edge> originalEdges;
+    
+    if(randomRepairsFileName.find("budding") != std::string::npos)
+        originalEdges = budding.edges;
+    else if(randomRepairsFileName.find("fission") != std::string::npos)
+        originalEdges = fission.edges;
+    else if(randomRepairsFileName.find("elegans") != std::string::npos)
+        originalEdges = elegans.edges;
+    else if(randomRepairsFileName.find("mammalian") != std::string::npos)
+        originalEdges = mammalian.edges;
+    else if(randomRepairsFileName.find("arabidopsis") != std::string::npos)
+        originalEdges = arabidopsis.edges;
+    
+    // built once, so comparing a repaired edge to the original network is a single lookup
+    EdgeSet originalEdgeSet;
+    originalEdgeSet.Build(originalEdges);
+    
+    AnswerSetReader randomRepairsFile;
+    std::ofstream outputFile(outputFileName);
+    
+    AnswerSet answerSet;
+    
+    // only the running statistics and one chunk of costs are kept, so the number of repairs is only limited by the file size
+    RuleStatistics statistics;
+    RepairCostTable table;
+    
+    unsigned int repairNumber = 0;
+    
+    if(randomRepairsFile.Open(randomRepairsFileName) && outputFile.is_open())
+    {
+        while(randomRepairsFile.Next(answerSet))
+        {
+            outputFile << "\nRepair: " << repairNumber++ << "\n\n";
+            
+            // save rule costs for statistical approach
+            table.Add(answerSet.repairCosts);
+            
+            if(table.repairsNum == REPAIR_TABLE_CHUNK)
+            {
+                statistics.AddTable(table);
+                table.Clear();
+            }
+            
+            // evaluate each repair, then pick the best one based on statistical approach
+            // I decided to evaluate all repairs in case we need to do some comparisons...
+            const std::vector<Edge> &resultEdges = answerSet.edges;
+            
+            timer.Count("modelsParsed", 1);
+            timer.Count("edgesCompared", resultEdges.size());
+            
+            WriteEdgeAtoms(outputFile, resultEdges);
+            outputFile << "\n";
+            
+            float nbOfSimilarEdges = (float)originalEdgeSet.CountCommon(resultEdges);
+            
+            float precision = nbOfSimilarEdges / resultEdges.size();
+            float recall = nbOfSimilarEdges / originalEdges.size();
+            
+            float f1_score = 2.0 * (precision * recall) / (precision + recall);
+            
+            outputFile << "\nPrecision: " << nbOfSimilarEdges << " / " << resultEdges.size() << " = " << precision << " (Nb. of edges in repaired network that are from original network)\n";
+            outputFile << "Recall: " << nbOfSimilarEdges << " / " << originalEdges.size() << " = " << recall << " (Nb. of edges in original network, found in repaired network)\n";
+            
+            outputFile << "\nF1-score = " << f1_score << "\n";
+            
+            float jaccardIndex = (float)nbOfSimilarEdges / ((float)originalEdges.size() + (float)resultEdges.size() - (float)nbOfSimilarEdges);
+            
+            outputFile << "\nJaccard Index = " << jaccardIndex << " (Intersection of original and repaired network divided by their union)\n";
+            
+            outputFile << "\n";
+        }
+        
+        statistics.AddTable(table);
+        table.Clear();
+        
+        // Pick the best repair based on statistical approach
+        // second pass over the file now that averages and standard deviations are known, one chunk of repairs at a time
+        
+        // pick repair with smallest z-score as best repair
+        double smallestZScore = 999999.0;
+        size_t bestRepair = 0;
+        
+        std::vector<unsigned int> bestCosts;
+        std::vector<double> totalZScores;
+        
+        size_t firstRepairOfChunk = 0;
+        
+        randomRepairsFile.Close();
+        randomRepairsFile.Open(randomRepairsFileName);
+        
+        bool moreRepairs = true;
+        
+        while(moreRepairs)
+        {
+            moreRepairs = randomRepairsFile.Next(answerSet);
+            
+            if(moreRepairs)
+                table.Add(answerSet.repairCosts);
+            
+            if(table.repairsNum < REPAIR_TABLE_CHUNK && moreRepairs)
+                continue;
+            
+            ComputeTotalZScores(table, statistics, totalZScores);
+            
+            for(size_t i = 0; i < table.repairsNum; ++i)
+            {
+                if(totalZScores[i] < smallestZScore)
+                {
+                    smallestZScore = totalZScores[i];
+                    bestRepair = firstRepairOfChunk + i;
+                    
+                    bestCosts.resize(table.RulesNum());
+                    
+                    for(size_t rule = 0; rule < table.RulesNum(); ++rule)
+                        bestCosts[rule] = table.columns[rule][i];
+                }
+            }
+            
+            firstRepairOfChunk += table.repairsNum;
+            table.Clear();
+        }
+        
+        outputFile << "\n\n\nBEST REPAIR:\n";
+        outputFile << "============\n\n";
+        
+        outputFile << "Repair: " << bestRepair;
+        
+        outputFile << "\n\nCost of rules: ";
+        
+        for(size_t i = 0; i < bestCosts.size(); ++i)
+            outputFile << bestCosts[i] << " ";
+        
+        outputFile << "\n\n\n";
+        
+        randomRepairsFile.Close();
+        outputFile.close();
+    }
+    else
+    {
+        std::cout << "ERROR: Unable to open random repairs file or create output file..\n";
+        return;
+    }
+    
+    std::cout << "\n\nFINISHED STATISTICAL APPROACH AND CREATED OUTPUT FILE!\n\n";
+}
+
+void StatisticalApproachWithSignificance2(const std::string &randomRepairsFileName, const std::string &outputFileName)
+{
+    ScopedTimer timer("StatisticalApproachWithSignificance2", randomRepairsFileName);
+    
+    std::vector<Edge> originalEdges;
+    
+    if(randomRepairsFileName.find("budding") != std::string::npos)
+        originalEdges = budding.edges;
+    else if(randomRepairsFileName.find("fission") != std::string::npos)
+        originalEdges = fission.edges;
+    else if(randomRepairsFileName.find("elegans") != std::string::npos)
+        originalEdges = elegans.edges;
+    else if(randomRepairsFileName.find("mammalian") != std::string::npos)
+        originalEdges = mammalian.edges;
+    else if(randomRepairsFileName.find("arabidopsis") != std::string::npos)
+        originalEdges = arabidopsis.edges;
+    
+    std::ofstream outputFile(outputFileName);
+    
+    // one pass, only the running statistics are kept
+    RuleStatistics statistics;
+    
+    if(outputFile.is_open() && AddRuleStatistics(randomRepairsFileName, statistics))
+    {
+        size_t rulesNum = statistics.RulesNum();
+        
+        std::vector<double> averages(rulesNum);
+        std::vector<double> standardDeviations(rulesNum);
+        
+        for(size_t i = 0; i < rulesNum; ++i)
+        {
+            averages[i] = statistics.means[i];
+            standardDeviations[i] = statistics.StandardDeviation(i);
+        }
+        
+        outputFile << "\n\nAVERAGES:\n";
+        outputFile << "=========\n\n";
+        
+        for(size_t i = 0; i < rulesNum; ++i)
+            outputFile << "rule " << i << ": " << averages[i] << "\n";
+        
+        outputFile << "\n\nSTANDARD DEVIATIONS:\n";
+        outputFile << "====================\n\n";
+        
+        for(size_t i = 0; i < rulesNum; ++i)
+            outputFile << "rule " << i << ": " << standardDeviations[i] << "\n";
+        
+        outputFile << "\n\nASP CODE:\n";
+        outputFile << "=========\n\n";
+        
+        std::vector<std::string> zScoreNames;
+        
+        for(size_t i = 0; i < rulesNum; ++i)
+        {
+            if((averages[i] < 0.001) || (standardDeviations[i] < 0.1))
+                continue;
+            
+            outputFile << "cost" << i << "(X) :- repairCost(" << i << ",C), X=1000*C.\n";
+            // (the small epsilon keeps an exact average like 24.91 from truncating to 24909)
+            outputFile << "diff" << i << "(D) :- cost" << i << "(X), D=X-" << (int)(averages[i]*1000 + 1e-6) << ".\n";
+            outputFile << "zScore" << i << "(Z) :- diff" << i << "(D), Z=D/" << (int)(standardDeviations[i]*10 + 1e-6) << ".\n\n";
+            
+            std::string zScoreName;
+            
+            zScoreName += "zScore";
+            zScoreName += std::to_string(i);
+            
+            zScoreNames.push_back(zScoreName);
+        }
+        
+        if(zScoreNames.size() < 2)
+        {
+            std::cout << "ERROR: There is only 1 z-score greater than 0..\n";
+            return;
+        }
+        
+        
+        outputFile << "totalCost0(X) :- " << zScoreNames[0] << "(A), " << zScoreNames[1] << "(B), X=A+B.\n";
+        
+        size_t zScoreNum = zScoreNames.size();
+        size_t c;
+        
+        for(c = 2; c < zScoreNum; ++c)
+        {
+            outputFile << "totalCost" << (c - 1) << "(X) :- totalCost" << (c - 2) << "(A), " << zScoreNames[c] << "(B), X=A+B.\n";
+        }
+        
+        outputFile << "\ntotalCost(X) :- totalCost" << (c - 2) << "(X).\n\n";
+        
+        outputFile << "#minimize[totalCost(C)=C].\n\n";
+        
+        outputFile << "#hide.\n";
+        outputFile << "#show activates(X,Y).\n";
+        outputFile << "#show inhibits(X,Y).\n";
+        
+        
+        outputFile.close();
+    }
+    else
+    {
+        std::cout << "ERROR: Unable to open random repairs file or create output file..\n";
+        return;
+    }
+    
+    std::cout << "\n\nFINISHED STATISTICAL APPROACH AND CREATED OUTPUT FILE!\n\n";
+}
+
+
+// ranks the repairs of an answer set file by Pareto dominance of their repairCost vectors, without any z-score or weights
+// the repairs of the front (layer 0) are written as answer sets, so AnalyzeResult can be run on the output file;
+// the next layersNum - 1 layers are listed with their costs
+// layersNum = 1: only the front is needed, it is kept up to date while reading instead of sorting every repair
+void ParetoRanking(const std::string &repairsFileName, const std::string &outputFileName, unsigned int layersNum = 3)
+{
+    ScopedTimer timer("ParetoRanking", repairsFileName);
     
-    if(thcellTableSize != thcellTableElementsNum)
+    AnswerSetReader repairsFile;
+    std::ofstream outputFile(outputFileName);
+    
+    if(!repairsFile.Open(repairsFileName) || !outputFile.is_open())
     {
-        std::cout << "\nERROR: missing entries in thcell timeseries table...\n\n";
+        std::cout << "ERROR: Unable to open repairs file or create output file..\n";
         return;
     }
     
+    AnswerSet answerSet;
     
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    RepairCostTable table;
+    ParetoFront front;
     
-    std::cout << "\n\nFINISHED LOADING NETWORKS!\n\n";
+    size_t repairsNum = 0;
+    
+    while(repairsFile.Next(answerSet))
+    {
+        if(layersNum > 1)
+            table.Add(answerSet.repairCosts);
+        else
+            front.Add(answerSet.repairCosts, repairsNum);
+        
+        ++repairsNum;
+    }
+    
+    timer.Count("modelsParsed", repairsNum);
+    
+    std::vector<unsigned int> layers;
+    size_t allLayersNum = 1;
+    
+    if(layersNum > 1)
+    {
+        allLayersNum = NonDominatedSort(table, layers, layersNum);
+    }
+    else
+    {
+        layers.assign(repairsNum, 1);
+        
+        for(size_t i = 0; i < front.repairs.size(); ++i)
+            layers[front.repairs[i]] = 0;
+    }
+    
+    // (one more for the repairs below the layers that were sorted)
+    std::vector<size_t> layerSizes(allLayersNum + 1, 0);
+    
+    for(size_t i = 0; i < repairsNum; ++i)
+        ++layerSizes[std::min((size_t)layers[i], allLayersNum)];
+    
+    outputFile << "PARETO FRONT:\n";
+    outputFile << "=============\n\n";
+    
+    outputFile << (layerSizes.empty() ? 0 : layerSizes[0]) << " of " << repairsNum << " repairs are not dominated by any other repair\n\n";
+    
+    // second pass for the edges of the repairs of the front
+    repairsFile.Close();
+    repairsFile.Open(repairsFileName);
+    
+    size_t repair = 0;
+    
+    while(repairsFile.Next(answerSet))
+    {
+        if(layers[repair] == 0)
+        {
+            outputFile << "Answer: " << answerSet.number << "\n";
+            
+            WriteEdgeAtoms(outputFile, answerSet.edges);
+            
+            for(size_t rule = 0; rule < answerSet.repairCosts.size(); ++rule)
+                outputFile << " repairCost(" << rule << "," << answerSet.repairCosts[rule] << ")";
+            
+            outputFile << "\n";
+        }
+        
+        ++repair;
+    }
+    
+    for(size_t layer = 1; layer < allLayersNum && layer < layersNum; ++layer)
+    {
+        outputFile << "\n\nLAYER " << layer << ": " << layerSizes[layer] << " repairs\n";
+        outputFile << "=========\n\n";
+        
+        for(size_t i = 0; i < repairsNum; ++i)
+        {
+            if(layers[i] != layer)
+                continue;
+            
+            outputFile << "Repair: " << i << "  Cost of rules: ";
+            
+            for(size_t rule = 0; rule < table.RulesNum(); ++rule)
+                outputFile << table.columns[rule][i] << " ";
+            
+            outputFile << "\n";
+        }
+    }
+    
+    if(layersNum > 1)
+    {
+        outputFile << "\n\nRepairs per layer:";
+        
+        for(size_t layer = 0; layer < allLayersNum; ++layer)
+            outputFile << " " << layerSizes[layer];
+        
+        if(layerSizes[allLayersNum] > 0)
+            outputFile << " (" << layerSizes[allLayersNum] << " more below layer " << allLayersNum - 1 << ")";
+        
+        outputFile << "\n";
+    }
+    
+    repairsFile.Close();
+    outputFile.close();
+    
+    std::cout << "\n\nFINISHED PARETO RANKING AND CREATED OUTPUT FILE!\n\n";
 }
 
-void LearnNetworkProperties(const std::string &repairNetwork)
+
+// ranks the repairs of an answer set file by the lexicographic order of their sorted repairCost vectors
+// leximin: costs sorted from the smallest up, the repair with the smallest lowest cost comes first, ties are broken
+//          by the second lowest cost, and so on
+// leximax: costs sorted from the largest down, the repair with the smallest highest cost comes first (the repair whose
+//          worst rule is the least violated), ties are broken by the second highest cost, and so on
+// the topRepairsNum best repairs are written as answer sets, so AnalyzeResult can be run on the output file
+void LexicographicRanking(const std::string &repairsFileName, const std::string &outputFileName, bool leximax, unsigned int topRepairsNum = 10, unsigned int threadsNum = 0)
 {
-    if(repairNetwork != "budding")
+    ScopedTimer timer(leximax ? "LeximaxRanking" : "LeximinRanking", repairsFileName);
+    
+    AnswerSetReader repairsFile;
+    std::ofstream outputFile(outputFileName);
+    
+    if(!repairsFile.Open(repairsFileName) || !outputFile.is_open())
     {
-        budding.LearnProperties();
-        budding.PrintProperties();
+        std::cout << "ERROR: Unable to open repairs file or create output file..\n";
+        return;
     }
-    else
-        std::cout << "\n\n REPAIRING BUDDING NETWORK. NO LEARNING FROM BUDDING.\n\n";
     
-    if(repairNetwork != "fission")
+    AnswerSet answerSet;
+    RepairCostTable table;
+    
+    while(repairsFile.Next(answerSet))
+        table.Add(answerSet.repairCosts);
+    
+    timer.Count("modelsParsed", table.repairsNum);
+    
+    size_t rulesNum = table.RulesNum();
+    size_t repairsNum = table.repairsNum;
+    
+    // sorted costs of each repair, a row per repair
+    std::vector<unsigned int> keys(repairsNum * rulesNum);
+    
+    for(size_t rule = 0; rule < rulesNum; ++rule)
     {
-        fission.LearnProperties();
-        fission.PrintProperties();
+        const unsigned int *column = table.columns[rule].data();
+        
+        for(size_t i = 0; i < repairsNum; ++i)
+            keys[i * rulesNum + rule] = column[i];
     }
-    else
-        std::cout << "\n\n REPAIRING FISSION NETWORK. NO LEARNING FROM FISSION.\n\n";
     
-    if(repairNetwork != "elegans")
+    for(size_t i = 0; i < repairsNum; ++i)
     {
-        elegans.LearnProperties();
-        elegans.PrintProperties();
+        if(leximax)
+            std::sort(keys.data() + i * rulesNum, keys.data() + i * rulesNum + rulesNum, std::greater<unsigned int>());
+        else
+            std::sort(keys.data() + i * rulesNum, keys.data() + i * rulesNum + rulesNum);
     }
-    else
-        std::cout << "\n\n REPAIRING ELEGANS NETWORK. NO LEARNING FROM ELEGANS.\n\n";
     
-    if(repairNetwork != "mammalian")
+    std::vector<unsigned int> ranking(repairsNum);
+    
+    for(size_t i = 0; i < repairsNum; ++i)
+        ranking[i] = (unsigned int)i;
+    
+    // equal keys keep the order of the file
+    ParallelSort(ranking.begin(), ranking.end(), [&](unsigned int a, unsigned int b)
+    {
+        const unsigned int *keyA = keys.data() + a * rulesNum;
+        const unsigned int *keyB = keys.data() + b * rulesNum;
+        
+        for(size_t rule = 0; rule < rulesNum; ++rule)
+            if(keyA[rule] != keyB[rule])
+                return keyA[rule] < keyB[rule];
+        
+        return a < b;
+    }, threadsNum);
+    
+    size_t topNum = std::min((size_t)topRepairsNum, repairsNum);
+    
+    // number of repairs as good as the best one
+    size_t bestNum = 0;
+    
+    while(bestNum < repairsNum && (bestNum == 0 || std::equal(keys.data() + ranking[0] * rulesNum, keys.data() + ranking[0] * rulesNum + rulesNum, keys.data() + ranking[bestNum] * rulesNum)))
+        ++bestNum;
+    
+    outputFile << (leximax ? "LEXIMAX RANKING:\n" : "LEXIMIN RANKING:\n");
+    outputFile << "================\n\n";
+    
+    outputFile << bestNum << " of " << repairsNum << " repairs share the best sorted costs\n\n";
+    
+    for(size_t rank = 0; rank < topNum; ++rank)
+    {
+        outputFile << "Rank " << rank + 1 << ":  Repair: " << ranking[rank] << "  Sorted costs: ";
+        
+        for(size_t rule = 0; rule < rulesNum; ++rule)
+            outputFile << keys[ranking[rank] * rulesNum + rule] << " ";
+        
+        outputFile << "\n";
+    }
+    
+    outputFile << "\n\nTOP REPAIRS:\n";
+    outputFile << "============\n\n";
+    
+    // second pass for the edges of the top repairs, written in the order of their rank
+    std::vector<unsigned int> rankOfRepair(repairsNum, (unsigned int)topNum);
+    
+    for(size_t rank = 0; rank < topNum; ++rank)
+        rankOfRepair[ranking[rank]] = (unsigned int)rank;
+    
+    std::vector<std::string> topAnswerSets(topNum);
+    
+    repairsFile.Close();
+    repairsFile.Open(repairsFileName);
+    
+    size_t repair = 0;
+    
+    while(repairsFile.Next(answerSet))
+    {
+        if(rankOfRepair[repair] < topNum)
+        {
+            std::ostringstream answer;
+            
+            answer << "Answer: " << answerSet.number << "\n";
+            
+            WriteEdgeAtoms(answer, answerSet.edges);
+            
+            for(size_t rule = 0; rule < answerSet.repairCosts.size(); ++rule)
+                answer << " repairCost(" << rule << "," << answerSet.repairCosts[rule] << ")";
+            
+            answer << "\n";
+            
+            topAnswerSets[rankOfRepair[repair]] = answer.str();
+        }
+        
+        ++repair;
+    }
+    
+    for(size_t rank = 0; rank < topNum; ++rank)
+        outputFile << topAnswerSets[rank];
+    
+    repairsFile.Close();
+    outputFile.close();
+    
+    std::cout << "\n\nFINISHED " << (leximax ? "LEXIMAX" : "LEXIMIN") << " RANKING AND CREATED OUTPUT FILE!\n\n";
+}
+
+
+// *************************************************************************************************
+// Solver portfolio: the same ground program is given to several clasp processes at once, each with a
+// different configuration. The first one to finish with a conclusive answer wins and the others are
+// stopped. clasp exit codes: 10 = model found, 20 = unsatisfiable, 30 = optimum proven (or search
+// exhausted), +1 when interrupted (time limit), 0 = unknown.
+// *************************************************************************************************
+
+enum CLASP_EXIT_CODE
+{
+    CLASP_UNKNOWN = 0,
+    CLASP_INTERRUPTED = 1,
+    CLASP_SATISFIABLE = 10,
+    CLASP_UNSATISFIABLE = 20,
+    CLASP_EXHAUSTED = 30,
+};
+
+// *************************************************************************************************
+// Solver cache: the output of a solver call is kept in solverCache/<key>.txt, where the key is a hash
+// of the input program files, the exact clasp command lines (and how a portfolio picks its winner) and
+// the gringo/clasp versions. Running the same program again copies the cached output (models,
+// repairCost atoms and clasp's summary) to the result file instead of grounding and solving. Only conclusive answers are cached: a run that stopped at the
+// time limit could end differently next time.
+// *************************************************************************************************
+
+bool solverCacheEnabled = true;
+
+const std::string SOLVER_CACHE_DIRECTORY = "solverCache";
+
+// FNV-1a
+uint64_t HashBytes(const char *data, size_t size, uint64_t hash = 14695981039346656037ull)
+{
+    for(size_t i = 0; i < size; ++i)
+    {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ull;
+    }
+    
+    return hash;
+}
+
+// first line of "clasp --version" and "./gringo --version", asked once per run
+const std::string &SolverVersion()
+{
+    static const std::string version = []()
+    {
+        std::string versions;
+        
+        const char *commands[] = {"clasp --version 2>&1", "./gringo --version 2>&1"};
+        
+        for(size_t i = 0; i < 2; ++i)
+        {
+            FILE *pipe = popen(commands[i], "r");
+            
+            if(!pipe)
+                continue;
+            
+            char line[256] = {0};
+            
+            if(fgets(line, sizeof(line), pipe))
+                versions += line;
+            
+            pclose(pipe);
+        }
+        
+        return versions;
+    }();
+    
+    return version;
+}
+
+std::string SolverCacheKey(const std::vector<std::string> &programFileNames, const std::string &solverArguments)
+{
+    uint64_t hash = HashBytes(solverArguments.data(), solverArguments.size());
+    hash = HashBytes(SolverVersion().data(), SolverVersion().size(), hash);
+    
+    for(size_t i = 0; i < programFileNames.size(); ++i)
+    {
+        MappedFile file;
+        
+        if(!file.Open(programFileNames[i]))
+            return "";
+        
+        // the size goes in too, so the end of one file can't pass for the start of the next
+        uint64_t size = file.size;
+        
+        hash = HashBytes((const char *)&size, sizeof(size), hash);
+        hash = HashBytes(file.data, file.size, hash);
+    }
+    
+    char key[17];
+    snprintf(key, sizeof(key), "%016llx", (unsigned long long)hash);
+    
+    return key;
+}
+
+// copies the cached solver output to resultFileName, returns the clasp exit code it was cached with (-1 if not cached)
+int FetchCachedResult(const std::string &key, const std::string &resultFileName)
+{
+    if(!solverCacheEnabled || key.empty())
+        return -1;
+    
+    MappedFile file;
+    
+    if(!file.Open(SOLVER_CACHE_DIRECTORY + "/" + key + ".txt"))
+        return -1;
+    
+    // first line: exit code, then the solver output as it was
+    const char *fileEnd = file.data + file.size;
+    const char *outputBegin = (const char *)memchr(file.data, '\n', file.size);
+    
+    int exitCode = -1;
+    
+    if(outputBegin == nullptr || file.size < 9 || memcmp(file.data, "exitCode ", 9) != 0)
+        return -1;
+    
+    std::from_chars(file.data + 9, outputBegin, exitCode);
+    
+    std::ofstream resultFile(resultFileName, std::ios::binary);
+    
+    if(!resultFile.is_open())
+        return -1;
+    
+    resultFile.write(outputBegin + 1, fileEnd - (outputBegin + 1));
+    
+    return exitCode;
+}
+
+void StoreCachedResult(const std::string &key, const std::string &resultFileName, int exitCode)
+{
+    if(!solverCacheEnabled || key.empty())
+        return;
+    
+    if(exitCode != CLASP_SATISFIABLE && exitCode != CLASP_UNSATISFIABLE && exitCode != CLASP_EXHAUSTED)
+        return;
+    
+    MappedFile result;
+    
+    if(!result.Open(resultFileName))
+        return;
+    
+    mkdir(SOLVER_CACHE_DIRECTORY.c_str(), 0755);
+    
+    // written under a temporary name first, so a batch job never reads a half written entry
+    std::string entryFileName = SOLVER_CACHE_DIRECTORY + "/" + key + ".txt";
+    std::string temporaryFileName = entryFileName + "." + std::to_string(getpid()) + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    
+    std::ofstream entryFile(temporaryFileName, std::ios::binary);
+    
+    if(!entryFile.is_open())
+        return;
+    
+    entryFile << "exitCode " << exitCode << "\n";
+    entryFile.write(result.data, result.size);
+    entryFile.close();
+    
+    std::rename(temporaryFileName.c_str(), entryFileName.c_str());
+}
+
+
+// *************************************************************************************************
+// Solver statistics: clasp runs with --stats, and the statistics at the end of its output are kept as one
+// tab-separated line per solver call in solverStatistics.tsv, tagged with the network, the strategy and
+// the iteration (ElieRanking) they belong to:
+//
+//   network strategy iteration exitCode groundingSeconds solvingSeconds totalSeconds models optimization
+//   choices conflicts restarts atoms rules
+//
+// groundingSeconds is measured around gringo, solvingSeconds and totalSeconds are clasp's "Solving" and
+// "Time". Results that come from the solver cache aren't solver calls and aren't recorded.
+// *************************************************************************************************
+
+bool solverStatisticsEnabled = true;
+
+const std::string SOLVER_STATISTICS_FILE_NAME = "solverStatistics.tsv";
+
+struct SolverStatistics
+{
+    SolverStatistics()
     {
-        mammalian.LearnProperties();
-        mammalian.PrintProperties();
+        iteration = 0;
+        exitCode = -1;
+        
+        groundingSeconds = 0.0;
+        solvingSeconds = 0.0;
+        totalSeconds = 0.0;
+        
+        models = 0;
+        choices = 0;
+        conflicts = 0;
+        restarts = 0;
+        atoms = 0;
+        rules = 0;
     }
-    else
-        std::cout << "\n\n REPAIRING MAMMALIAN NETWORK. NO LEARNING FROM MAMMALIAN.\n\n";
     
-    if(repairNetwork != "arabidopsis")
+    std::string network;
+    std::string strategy;
+    unsigned int iteration;
+    
+    int exitCode;
+    
+    double groundingSeconds;
+    double solvingSeconds;
+    double totalSeconds;
+    
+    uint64_t models;
+    std::string optimization; // last optimization values (the bound reached), empty without optimization
+    
+    uint64_t choices;
+    uint64_t conflicts;
+    uint64_t restarts;
+    
+    uint64_t atoms; // of the ground program, as clasp read it
+    uint64_t rules;
+};
+
+// network and strategy of an ASP file named like our experiments: "<network><strategy>[_<variant>].txt", in any directory
+// (e.g. mammalianElieRanking_80_20.txt -> mammalian, ElieRanking; budding_80_20_3.txt -> budding, default)
+void TagSolverStatistics(const std::string &aspFileName, SolverStatistics &statistics)
+{
+    static const char *networkNames[] = {"budding", "fission", "elegans", "mammalian", "arabidopsis", "thcell", "synthetic"};
+    
+    size_t slash = aspFileName.find_last_of('/');
+    std::string baseName = (slash == std::string::npos) ? aspFileName : aspFileName.substr(slash + 1);
+    
+    statistics.network = "unknown";
+    statistics.strategy = baseName.substr(0, baseName.find_first_of("_."));
+    
+    for(size_t n = 0; n < sizeof(networkNames) / sizeof(networkNames[0]); ++n)
     {
-        arabidopsis.LearnProperties();
-        arabidopsis.PrintProperties();
+        size_t length = strlen(networkNames[n]);
+        
+        if(baseName.compare(0, length, networkNames[n]) == 0)
+        {
+            statistics.network = networkNames[n];
+            statistics.strategy = baseName.substr(length, baseName.find_first_of("_.", length) - length);
+            break;
+        }
     }
-    else
-        std::cout << "\n\n REPAIRING ARABIDOPSIS NETWORK. NO LEARNING FROM ARABIDOPSIS.\n\n";
+    
+    if(statistics.strategy.empty())
+        statistics.strategy = "default";
 }
 
-
-void AnalyzeResult(const std::string &resultFileName, const std::string &outputFileName)
+// statistics printed by clasp --stats ("Key : value" lines, the last one of each key counts)
+// leading decimal number of [begin, end) ("0.020s" -> 0.02), 0 if there is none
+// (std::from_chars has no floating point overload in the libc++ of the Xcode build, so strtod on a bounded copy)
+double ParseSeconds(const char *begin, const char *end)
 {
-    std::vector<Edge> originalEdges;
+    char number[32];
+    size_t length = std::min((size_t)(end - begin), sizeof(number) - 1);
     
-    if(resultFileName.find("budding") != std::string::npos)
-        originalEdges = budding.edges;
-    else if(resultFileName.find("fission") != std::string::npos)
-        originalEdges = fission.edges;
-    else if(resultFileName.find("elegans") != std::string::npos)
-        originalEdges = elegans.edges;
-    else if(resultFileName.find("mammalian") != std::string::npos)
-        originalEdges = mammalian.edges;
-    else if(resultFileName.find("arabidopsis") != std::string::npos)
-        originalEdges = arabidopsis.edges;
+    memcpy(number, begin, length);
+    number[length] = '\0';
     
-    std::ifstream resultFile(resultFileName);
-    std::ofstream outputFile(outputFileName);
+    return strtod(number, nullptr);
+}
+
+bool ReadSolverStatistics(const std::string &outputFileName, SolverStatistics &statistics)
+{
+    MappedFile file;
     
-    std::string resultLine;
+    if(!file.Open(outputFileName))
+        return false;
     
-    if(resultFile.is_open() && outputFile.is_open())
+    const char *position = file.data;
+    const char *fileEnd = file.data + file.size;
+    
+    while(position < fileEnd)
     {
-        while(getline(resultFile, resultLine))
+        const char *lineEnd = (const char *)memchr(position, '\n', fileEnd - position);
+        
+        if(lineEnd == nullptr)
+            lineEnd = fileEnd;
+        
+        const char *colon = (const char *)memchr(position, ':', lineEnd - position);
+        
+        if(colon != nullptr)
         {
-            // search for Answer line
-            if(resultLine.find("Answer:") != std::string::npos)
+            const char *keyEnd = colon;
+            
+            while(keyEnd > position && keyEnd[-1] == ' ')
+                --keyEnd;
+            
+            std::string key(position, keyEnd);
+            
+            const char *value = colon + 1;
+            
+            while(value < lineEnd && *value == ' ')
+                ++value;
+            
+            // first number of the value ("1+", "0.020s (Solving: 0.00s ...)", "567 (Original: 500 ...)")
+            uint64_t number = 0;
+            
+            std::from_chars(value, lineEnd, number);
+            
+            if(key == "Models")
+                statistics.models = number;
+            else if(key == "Optimization")
+                statistics.optimization = std::string(value, lineEnd);
+            else if(key == "Choices")
+                statistics.choices = number;
+            else if(key == "Conflicts")
+                statistics.conflicts = number;
+            else if(key == "Restarts")
+                statistics.restarts = number;
+            else if(key == "Atoms")
+                statistics.atoms = number;
+            else if(key == "Rules")
+                statistics.rules = number;
+            else if(key == "Time")
             {
-                unsigned int answerNumber = 0;
-                sscanf(resultLine.c_str(), "Answer: %d", &answerNumber);
-                
-                outputFile << "Answer: " << answerNumber << "\n";
+                statistics.totalSeconds = ParseSeconds(value, lineEnd);
                 
-                // get the actual answer set line
-                getline(resultFile, resultLine);
+                const char *solving = std::search(value, lineEnd, "Solving:", "Solving:" + 8);
                 
-                // get rid of answer sets that have "repairCost" after "activates/inhibits" (Elie's ranking case)
-                std::string resultLineOnlyActivatesInhibits(resultLine, 0, resultLine.find_first_of("r")-1);
-                
-                resultLine = resultLineOnlyActivatesInhibits;
-                
-                size_t pos1 = 0;
-                size_t pos2 = resultLine.find_first_of(" ");
-                
-                std::string restOfResultLine;
-                
-                std::vector<Edge> resultEdges;
-                
-                // stop at the edge before the last (because the end of the line is not a ' ')
-                while(pos1 < pos2)
+                if(solving != lineEnd)
                 {
-                    std::string resultEdge = std::string(resultLine, pos1, pos2-pos1);
-                    
-                    unsigned int edgeFrom;
-                    unsigned int edgeTo;
-                    
-                    if(resultEdge[0] == 'a')
-                    {
-                        sscanf(resultEdge.c_str(), "activates(%d,%d)", &edgeFrom, &edgeTo);
-                        resultEdges.push_back(Edge(ACTIVATES, edgeFrom, edgeTo));
-                    }
-                    else
-                    {
-                        sscanf(resultEdge.c_str(), "inhibits(%d,%d)", &edgeFrom, &edgeTo);
-                        resultEdges.push_back(Edge(INHIBITS, edgeFrom, edgeTo));
-                    }
+                    solving += 8;
                     
-                    outputFile << resultEdge << " ";
+                    while(solving < lineEnd && *solving == ' ')
+                        ++solving;
                     
-                    pos1 = pos2 + 1;
-                    
-                    restOfResultLine = std::string(resultLine, pos1, resultLine.size());
-                    pos2 += (restOfResultLine.find_first_of(" ") + 1);
-                }
-                
-                // Don't forget last edge
-                outputFile << restOfResultLine << "\n";
-                
-                unsigned int edgeFrom;
-                unsigned int edgeTo;
-                
-                if(restOfResultLine[0] == 'a')
-                {
-                    sscanf(restOfResultLine.c_str(), "activates(%d,%d)", &edgeFrom, &edgeTo);
-                    resultEdges.push_back(Edge(ACTIVATES, edgeFrom, edgeTo));
-                }
-                else
-                {
-                    sscanf(restOfResultLine.c_str(), "inhibits(%d,%d)", &edgeFrom, &edgeTo);
-                    resultEdges.push_back(Edge(INHIBITS, edgeFrom, edgeTo));
-                }
-                
-                float nbOfSimilarEdges = 0;
-                
-                for(size_t i = 0; i < resultEdges.size(); ++i)
-                {
-                    for(size_t j = 0; j < originalEdges.size(); ++j)
-                    {
-                        if(resultEdges[i] == originalEdges[j])
-                            nbOfSimilarEdges += 1;
-                    }
+                    statistics.solvingSeconds = ParseSeconds(solving, lineEnd);
                 }
-                
-                float precision = nbOfSimilarEdges / resultEdges.size();
-                float recall = nbOfSimilarEdges / originalEdges.size();
-                
-                float f1_score = 2.0 * (precision * recall) / (precision + recall);
-                
-                outputFile << "\nPrecision: " << nbOfSimilarEdges << " / " << resultEdges.size() << " = " << precision << " (Nb. of edges in repaired network that are from original network)\n";
-                outputFile << "Recall: " << nbOfSimilarEdges << " / " << originalEdges.size() << " = " << recall << " (Nb. of edges in original network, found in repaired network)\n";
-                
-                outputFile << "\nF1-score = " << f1_score << "\n";
-                
-                float jaccardIndex = (float)nbOfSimilarEdges / ((float)originalEdges.size() + (float)resultEdges.size() - (float)nbOfSimilarEdges);
-                
-                outputFile << "\nJaccard Index = " << jaccardIndex << " (Intersection of original and repaired network divided by their union)\n";
-                
-                outputFile << "\n";
             }
         }
         
-        
-        resultFile.close();
-        outputFile.close();
-    }
-    else
-    {
-        std::cout << "ERROR: Unable to open result file or create output file..\n";
-        return;
+        position = lineEnd + 1;
     }
     
-    std::cout << "\n\nFINISHED ANALYZING RESULT AND CREATING FILE!\n\n";
+    return true;
 }
 
-
-
-std::string GetNextIntermediateName()
+// reads the statistics of a solver output and appends them to SOLVER_STATISTICS_FILE_NAME (safe from several threads)
+void RecordSolverStatistics(const std::string &aspFileName, const std::string &outputFileName, unsigned int iteration, int exitCode, double groundingSeconds)
 {
-    static char character = 'A';
-    static unsigned int number = 0;
+    if(!solverStatisticsEnabled)
+        return;
     
-    std::string intermediate;
+    SolverStatistics statistics;
     
-    intermediate += character;
-    intermediate += std::to_string(number);
+    TagSolverStatistics(aspFileName, statistics);
     
-    ++character;
+    statistics.iteration = iteration;
+    statistics.exitCode = exitCode;
+    statistics.groundingSeconds = groundingSeconds;
     
-    if(character > 'Z')
+    ReadSolverStatistics(outputFileName, statistics);
+    
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    
+    bool newFile = (TracedFileSize(SOLVER_STATISTICS_FILE_NAME) == 0);
+    
+    std::ofstream statisticsFile(SOLVER_STATISTICS_FILE_NAME, std::ios::app);
+    
+    if(!statisticsFile.is_open())
     {
-        character = 'A';
-        ++number;
+        std::cout << "ERROR: Unable to open solver statistics file..\n";
+        return;
     }
     
-    return intermediate;
+    if(newFile)
+    {
+        statisticsFile << "network\tstrategy\titeration\texitCode\tgroundingSeconds\tsolvingSeconds\ttotalSeconds\tmodels\toptimization";
+        statisticsFile << "\tchoices\tconflicts\trestarts\tatoms\trules\n";
+    }
+    
+    statisticsFile << statistics.network << "\t" << statistics.strategy << "\t" << statistics.iteration << "\t" << statistics.exitCode;
+    statisticsFile << "\t" << statistics.groundingSeconds << "\t" << statistics.solvingSeconds << "\t" << statistics.totalSeconds;
+    statisticsFile << "\t" << statistics.models << "\t" << (statistics.optimization.empty() ? "NA" : statistics.optimization);
+    statisticsFile << "\t" << statistics.choices << "\t" << statistics.conflicts << "\t" << statistics.restarts;
+    statisticsFile << "\t" << statistics.atoms << "\t" << statistics.rules << "\n";
 }
 
 
-// ********************************************************************************************************************************************
-// ********************************************************************************************************************************************
-// TO DO: FINISH THIS!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-// ********************************************************************************************************************************************
-// ********************************************************************************************************************************************
-GeneNetwork CorruptNetwork(const GeneNetwork &geneNetwork, float addedEdgesRatio, float removedEdgesRatio)
+// clasp configurations that behave differently enough on our programs to be worth running side by side
+const std::vector<std::string> &SolverPortfolio()
 {
-    GeneNetwork corruptedNetwork;
-    
-    if(!geneNetwork.addedEdges.empty())
+    static const std::vector<std::string> portfolio =
     {
-        std::cout << "ERROR: Trying to corrupt a network that is already corrupted!\n";
-        return corruptedNetwork;
-    }
+        "--configuration=frumpy",
+        "--configuration=jumpy",
+        "--configuration=tweety",
+        "--configuration=trendy --seed=1",
+        "--configuration=crafty --seed=2",
+        "--configuration=handy",
+        "--heuristic=Vsids --restarts=L,128 --seed=3",
+        "--heuristic=Berkmin --restarts=D,100,0.7 --rand-freq=0.02 --seed=4",
+    };
+    
+    return portfolio;
+}
+
+// values of the last "Optimization:" line of a clasp output (empty if the program doesn't optimize or no model was found)
+std::vector<long> ReadOptimizationValues(const std::string &outputFileName)
+{
+    std::vector<long> values;
     
-    std::vector<Edge> edges;
-    std::vector<Edge> addedEdges;
+    MappedFile file;
     
-    for(size_t i = 0; i < geneNetwork.edges.size(); ++i)
-        edges.push_back(geneNetwork.edges[i]);
+    if(!file.Open(outputFileName))
+        return values;
     
-    unsigned int nbOfEdgesToRemove = geneNetwork.edges.size() * removedEdgesRatio;
-    unsigned int nbOfEdgesToAdd = geneNetwork.edges.size() * addedEdgesRatio;
+    const char *fileEnd = file.data + file.size;
+    const char *word = "Optimization:";
+    const char *found = fileEnd;
     
+    for(const char *current = std::search(file.data, fileEnd, word, word + 13); current != fileEnd; current = std::search(current + 13, fileEnd, word, word + 13))
+        found = current;
     
+    if(found == fileEnd)
+        return values;
     
+    const char *current = found + 13;
+    const char *lineEnd = (const char *)memchr(current, '\n', fileEnd - current);
     
+    if(lineEnd == nullptr)
+        lineEnd = fileEnd;
     
+    while(current < lineEnd)
+    {
+        if(*current == ' ')
+        {
+            ++current;
+            continue;
+        }
+        
+        long value = 0;
+        std::from_chars_result result = std::from_chars(current, lineEnd, value);
+        
+        if(result.ec != std::errc())
+            break;
+        
+        values.push_back(value);
+        current = result.ptr;
+    }
     
+    return values;
+}
+
+// clasp command line (without input and output) for one configuration, "" is clasp's default configuration
+std::string ClaspCommand(const std::string &configuration, unsigned int timeLimit)
+{
+    std::string commandString = "clasp";
     
-    for(size_t i = 0; i < edges.size(); ++i)
-        corruptedNetwork.edges.push_back(edges[i]);
+    if(!configuration.empty())
+        commandString += " " + configuration;
     
-    for(size_t i = 0; i < addedEdges.size(); ++i)
-        corruptedNetwork.addedEdges.push_back(addedEdges[i]);
+    commandString += " --time-limit=" + std::to_string(timeLimit);
+    commandString += solverStatisticsEnabled ? " --stats" : "";
     
-    return corruptedNetwork;
+    return commandString;
 }
 
+// number of solvers RunSolverPortfolio actually runs for solversNum
+unsigned int PortfolioSize(unsigned int solversNum)
+{
+    return std::max(1u, std::min(solversNum, (unsigned int)SolverPortfolio().size()));
+}
 
+// everything a RunSolverPortfolio result depends on besides the program: how the winner is picked and the exact
+// command line of every solver (the solver cache key of portfolio runs)
+std::string PortfolioSolverArguments(unsigned int solversNum, unsigned int timeLimit, bool optimize)
+{
+    std::string arguments = optimize ? "portfolio optimize\n" : "portfolio first model\n";
+    
+    for(unsigned int i = 0; i < PortfolioSize(solversNum); ++i)
+        arguments += ClaspCommand(SolverPortfolio()[i], timeLimit) + "\n";
+    
+    return arguments;
+}
 
-void CreateASPfile(const GeneNetwork &geneNetwork, const std::string &fileName, bool rulesOfThumb = false)
+// runs up to solversNum clasp configurations of SolverPortfolio() on groundProgramFileName, in parallel
+// optimize: only a proven optimum (or unsatisfiability) ends the race early, otherwise the first model does
+// if nobody is conclusive within timeLimit, the output with the best optimization values (or any model) is kept
+// the winning clasp output ends up in resultFileName, returns its clasp exit code (-1 if no solver could be run)
+int RunSolverPortfolio(const std::string &groundProgramFileName, const std::string &resultFileName, unsigned int solversNum, unsigned int timeLimit, bool optimize)
 {
-    std::ofstream file(fileName);
+    ScopedTimer timer("RunSolverPortfolio", groundProgramFileName);
     
-    if(file.is_open())
+    const std::vector<std::string> &portfolio = SolverPortfolio();
+    
+    solversNum = PortfolioSize(solversNum);
+    
+    timer.Count("solvers", solversNum);
+    timer.Count("bytesRead", TracedFileSize(groundProgramFileName));
+    
+    std::vector<pid_t> processes(solversNum, -1);
+    std::vector<int> exitCodes(solversNum, -1);
+    
+    for(unsigned int i = 0; i < solversNum; ++i)
     {
-        file << "% genes (nodes) of " << geneNetwork.name << " network\n";
+        std::string commandString;
         
-        for(size_t i = 1; i <= geneNetwork.geneNum; ++i)
-            file << "gene(" << i << ").\n";
+        // "exec" so the clasp process is the one we can stop (and not a shell around it)
+        commandString += "exec " + ClaspCommand(portfolio[i], timeLimit);
+        commandString += " < " + groundProgramFileName;
+        commandString += " > " + resultFileName + ".solver" + std::to_string(i);
         
-        file << "\n% time steps\n";
+        pid_t process = fork();
         
-        for(size_t i = 1; i <= geneNetwork.timeSteps; ++i)
-            file << "time(" << i << ").\n";
+        if(process == 0)
+        {
+            execl("/bin/sh", "sh", "-c", commandString.c_str(), (char *)nullptr);
+            _exit(127);
+        }
         
-        file << "\n% edges between genes\n";
-        file << "% " << geneNetwork.edges.size() << " initial edges\n";
+        if(process < 0)
+            std::cout << "ERROR: Unable to start solver " << i << " (" << portfolio[i] << ")..\n";
         
-        size_t edgesNum = geneNetwork.edges.size();
-        for(size_t currentEdge = 0; currentEdge < edgesNum; ++currentEdge)
+        processes[i] = process;
+    }
+    
+    int winner = -1;
+    unsigned int runningNum = 0;
+    
+    for(unsigned int i = 0; i < solversNum; ++i)
+        if(processes[i] > 0)
+            ++runningNum;
+    
+    // only this call's solvers are waited on (never waitpid(-1)): portfolios of other batch threads and their
+    // gringo calls run in this process too, and reaping one of their children would lose its result
+    while(runningNum > 0 && winner < 0)
+    {
+        bool exited = false;
+        
+        for(unsigned int i = 0; i < solversNum && winner < 0; ++i)
         {
-            if(geneNetwork.edges[currentEdge].type == EDGE_TYPE::ACTIVATES)
-            {
-                file << "edge(" << geneNetwork.edges[currentEdge].from << "," << geneNetwork.edges[currentEdge].to << ",1).\n";
-            }
+            if(processes[i] <= 0)
+                continue;
             
-            if(geneNetwork.edges[currentEdge].type == EDGE_TYPE::INHIBITS)
-            {
-                file << "edge(" << geneNetwork.edges[currentEdge].from << "," << geneNetwork.edges[currentEdge].to << ",-1).\n";
-            }
+            int status = 0;
+            pid_t process = waitpid(processes[i], &status, WNOHANG);
+            
+            if(process == 0)
+                continue;
+            
+            processes[i] = -1;
+            --runningNum;
+            exited = true;
+            
+            exitCodes[i] = (process > 0 && WIFEXITED(status)) ? WEXITSTATUS(status) : -1;
+            
+            bool conclusive = (exitCodes[i] == CLASP_UNSATISFIABLE || exitCodes[i] == CLASP_EXHAUSTED) ||
+                              (!optimize && exitCodes[i] == CLASP_SATISFIABLE);
+            
+            if(conclusive)
+                winner = i;
         }
         
-        file << "\n% " << geneNetwork.addedEdges.size() << " added edges\n";
+        if(!exited)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    
+    // stop the rest of the portfolio
+    for(unsigned int i = 0; i < solversNum; ++i)
+    {
+        if(processes[i] <= 0)
+            continue;
         
-        if(geneNetwork.addedEdges.empty())
-            std::cout << "\nWARNING: There are no added edges to corrupt the original network..\n\n";
+        kill(processes[i], SIGKILL);
+        waitpid(processes[i], nullptr, 0);
+    }
+    
+    // nobody was conclusive (time limit): keep the best model found, if any
+    if(winner < 0)
+    {
+        std::vector<long> bestValues;
         
-        size_t addedEdgesNum = geneNetwork.addedEdges.size();
-        for(size_t currentEdge = 0; currentEdge < addedEdgesNum; ++currentEdge)
+        for(unsigned int i = 0; i < solversNum; ++i)
         {
-            if(geneNetwork.addedEdges[currentEdge].type == EDGE_TYPE::ACTIVATES)
-            {
-                file << "edge(" << geneNetwork.addedEdges[currentEdge].from << "," << geneNetwork.addedEdges[currentEdge].to << ",1).\n";
-            }
+            if(exitCodes[i] != CLASP_SATISFIABLE && exitCodes[i] != CLASP_SATISFIABLE + CLASP_INTERRUPTED)
+                continue;
             
-            if(geneNetwork.addedEdges[currentEdge].type == EDGE_TYPE::INHIBITS)
+            std::vector<long> values = ReadOptimizationValues(resultFileName + ".solver" + std::to_string(i));
+            
+            if(winner < 0 || (optimize && values < bestValues))
             {
-                file << "edge(" << geneNetwork.addedEdges[currentEdge].from << "," << geneNetwork.addedEdges[currentEdge].to << ",-1).\n";
+                winner = i;
+                bestValues = values;
             }
         }
+    }
+    
+    // still nothing: any solver that ran, so the output says UNKNOWN like a single clasp would
+    for(unsigned int i = 0; i < solversNum && winner < 0; ++i)
+        if(exitCodes[i] >= 0)
+            winner = i;
+    
+    if(winner >= 0)
+    {
+        std::cout << "Solver portfolio: " << portfolio[winner] << " won (exit code " << exitCodes[winner] << ")\n";
+        std::rename((resultFileName + ".solver" + std::to_string(winner)).c_str(), resultFileName.c_str());
         
-        file << "\nedge(U,V) :- edge(U,V,S).\n";
-        
-        
-        file << "\n% either add an activation edge, or an inhibition either, or nothing\n";
-        file << "% this also doesn't allow the addition of both between a pair of nodes\n";
-        file << "addActEdge(U,V) :- gene(U), gene(V), not edge(U,V), not addInhEdge(U,V), not nAddActEdge(U,V).\n";
-        file << "nAddActEdge(U,V) :- gene(U), gene(V), not edge(U,V), not addInhEdge(U,V), not addActEdge(U,V).\n";
-        
-        file << "\naddInhEdge(U,V) :- gene(U), gene(V), not edge(U,V), not addActEdge(U,V), not nAddInhEdge(U,V).\n";
-        file << "nAddInhEdge(U,V) :- gene(U), gene(V), not edge(U,V), not addActEdge(U,V), not addInhEdge(U,V).\n";
-        
-        file << "\n% either remove or don't remove existing edges\n";
-        file << "removeEdge(U,V,S) :- edge(U,V,S), not nRemoveEdge(U,V,S).\n";
-        file << "nRemoveEdge(U,V,S) :- edge(U,V,S), not removeEdge(U,V,S).\n";
-        
-        
-        file << "\n% generate activates(U,V) and inhibits(U,V) to check consistency between graph and table\n";
-        file << "activates(U,V) :- edge(U,V,1), not removeEdge(U,V,1).\n";
-        file << "activates(U,V) :- addActEdge(U,V).\n";
-        
-        file << "\ninhibits(U,V) :- edge(U,V,-1), not removeEdge(U,V,-1).\n";
-        file << "inhibits(U,V) :- addInhEdge(U,V).\n";
-        
-        file << "\n% a gene either activates or inhibits another gene\n";
-        file << "% (this will make sure we don't add an activation edge and an inhibition edge at the same\n";
-        file << "% time between two genes)\n";
-        file << " :- activates(X,Y), inhibits(X,Y).\n";
+        timer.Count("bytesWritten", TracedFileSize(resultFileName));
+    }
+    
+    for(unsigned int i = 0; i < solversNum; ++i)
+        if((int)i != winner)
+            std::remove((resultFileName + ".solver" + std::to_string(i)).c_str());
+    
+    return (winner >= 0) ? exitCodes[winner] : -1;
+}
+
+// grounds aspFileName once with gringo and races a solver portfolio on it
+// the result file has clasp's output format, so AnalyzeResult/AnswerSetReader read it as usual
+int SolveWithPortfolio(const std::string &aspFileName, const std::string &resultFileName, unsigned int solversNum, unsigned int timeLimit, bool optimize)
+{
+    std::string cacheKey = SolverCacheKey({aspFileName}, PortfolioSolverArguments(solversNum, timeLimit, optimize));
+    
+    int cachedExitCode = FetchCachedResult(cacheKey, resultFileName);
+    
+    if(cachedExitCode >= 0)
+        return cachedExitCode;
+    
+    const std::string groundProgramFileName = resultFileName + ".ground";
+    
+    std::chrono::steady_clock::time_point groundingStart = std::chrono::steady_clock::now();
+    
+    {
+        ScopedTimer timer("gringo", aspFileName);
         
-        file << "\n% literals to count added edges all together\n";
-        file << "% (I keep the signs so I can quickly see what is being added in answer sets)\n";
-        file << "addEdge(U,V,1) :- addActEdge(U,V).\n";
-        file << "addEdge(U,V,-1) :- addInhEdge(U,V).\n";
+        std::string commandString = "./gringo " + aspFileName + " > " + groundProgramFileName;
         
-        file << "\n% compute cost of adding and removing edges\n";
-        file << "costAdding(X) :- X = #count{addEdge(U,V,_)}.\n";
-        file << "costRemoving(Y) :- Y = #count{removeEdge(U,V,_)}.\n";
+        if(std::system(commandString.c_str()) != 0)
+        {
+            std::cout << "ERROR: Unable to ground " << aspFileName << "..\n";
+            return -1;
+        }
         
-        file << "\nrepairCost(0,Z) :- costAdding(X), costRemoving(Y), Z=X+Y.\n";
+        timer.Count("bytesRead", TracedFileSize(aspFileName));
+        timer.Count("bytesWritten", TracedFileSize(groundProgramFileName));
+    }
+    
+    double groundingSeconds = SecondsSince(groundingStart);
+    
+    int exitCode = RunSolverPortfolio(groundProgramFileName, resultFileName, solversNum, timeLimit, optimize);
+    
+    RecordSolverStatistics(aspFileName, resultFileName, 0, exitCode, groundingSeconds);
+    
+    std::remove(groundProgramFileName.c_str());
+    
+    StoreCachedResult(cacheKey, resultFileName, exitCode);
+    
+    return exitCode;
+}
+
+
+// constraint that makes the next repair improve on more rules than it worsens, compared to the repairCost values of the last one
+// clingoSyntax: "#program better(k,r,v)." grounded once per rule and "#program betterCheck(k)." once per iteration (in-process solving)
+// otherwise: gringo 3 rules for iteration changeCounter with the values written in
+// (values needs at least one rule, with none the sum is 0 and the constraint can never be satisfied)
+std::string CreateDominanceConstraint(bool clingoSyntax, unsigned int changeCounter = 0, const std::vector<unsigned int> &values = std::vector<unsigned int>())
+{
+    std::string constraint;
+    
+    if(clingoSyntax)
+    {
+        constraint += "#program better(k,r,v).\n";
+        constraint += "change(k,r,-1) :- repairCost(r,X), X < v.\n";
+        constraint += "change(k,r,1) :- repairCost(r,X), X > v.\n";
         
+        constraint += "#program betterCheck(k).\n";
+        constraint += " :- #sum{S,R : change(k,R,S)} >= 0.\n";
         
-        file << "\n";
-        file << "% observations at different time steps\n\n";
-        file << "% timeseries table\n";
+        return constraint;
+    }
+    
+    std::string change = "change" + std::to_string(changeCounter);
+    
+    for(size_t rule = 0; rule < values.size(); ++rule)
+        constraint += change + "(" + std::to_string(rule) + ",-1) :- repairCost(" + std::to_string(rule) + ",X), X < " + std::to_string(values[rule]) + ".\n";
+    
+    constraint += "\n";
+    
+    for(size_t rule = 0; rule < values.size(); ++rule)
+        constraint += change + "(" + std::to_string(rule) + ",1) :- repairCost(" + std::to_string(rule) + ",X), X > " + std::to_string(values[rule]) + ".\n";
+    
+    constraint += "\ntotalChange" + std::to_string(changeCounter) + "(C) :- C = #sum[" + change + "(X,Y)=Y].\n\n";
+    constraint += " :- totalChange" + std::to_string(changeCounter) + "(C), C >= 0.\n\n";
+    
+    return constraint;
+}
+
+
+#ifdef USE_CLINGO
+
+enum SOLVE_RESULT
+{
+    SOLVE_MODEL_FOUND = 0,
+    SOLVE_UNSATISFIABLE,
+    SOLVE_TIME_LIMIT,
+    SOLVE_ERROR,
+};
+
+// keeps one clingo control object alive, so a program is parsed and grounded once and then solved (and extended) in place
+struct ClingoSolver
+{
+    ClingoSolver()
+    {
+        control = nullptr;
         
-        size_t tableSize = geneNetwork.table.size();
-        for(size_t i = 0; i < tableSize; ++i)
+        if(!clingo_control_new(nullptr, 0, nullptr, nullptr, 20, &control))
         {
-            if(geneNetwork.table[i].type == TABLE_TYPE::ACTIVE)
-            {
-                file << "active(" << geneNetwork.table[i].gene << "," << geneNetwork.table[i].time << ").\n";
-            }
-            
-            if(geneNetwork.table[i].type == TABLE_TYPE::INACTIVE)
-            {
-                file << "inactive(" << geneNetwork.table[i].gene << "," << geneNetwork.table[i].time << ").\n";
-            }
+            std::cout << "ERROR: Unable to create clingo control: " << clingo_error_message() << "..\n";
+            control = nullptr;
         }
+    }
+    
+    ~ClingoSolver()
+    {
+        if(control)
+            clingo_control_free(control);
+    }
+    
+    ClingoSolver(const ClingoSolver &) = delete;
+    ClingoSolver &operator=(const ClingoSolver &) = delete;
+    
+    // adds a program part (given as text) and grounds it
+    bool AddAndGround(const std::string &partName, const std::string &program)
+    {
+        return Add(partName, program) && Ground(partName, std::vector<int>());
+    }
+    
+    // parses a program part, "#program partName(p1,...)." inside the text makes it a part that can be grounded many times
+    bool Add(const std::string &partName, const std::string &program)
+    {
+        if(!control)
+            return false;
         
+        if(!clingo_control_add(control, partName.c_str(), nullptr, 0, program.c_str()))
+        {
+            std::cout << "ERROR: clingo could not parse program part " << partName << ": " << clingo_error_message() << "..\n";
+            return false;
+        }
         
-        file << "\n% activation and inhibition rules\n";
-        
-        file << "\n% Y receives activation at time T if X activates Y and X is active at time T\n";
-        file << "receivesActivation(Y,T) :- activates(X,Y), active(X,T).\n";
+        return true;
+    }
+    
+    // grounds (one more instance of) a program part, only the new rules are grounded, the rest of the ground program is kept
+    bool Ground(const std::string &partName, const std::vector<int> &parameters)
+    {
+        if(!control)
+            return false;
         
-        file << "\n% Y receives inhibition at time T if X inhibits Y and X is active at time T\n";
-        file << "receivesInhibition(Y,T) :- inhibits(X,Y), active(X,T).\n";
+        ScopedTimer timer("clingo ground", partName);
         
-        file << "\n% determine whether a gene is activated or inhibited (or none) at each time step\n";
-        file << "activated(Y,T) :- receivesActivation(Y,T-1), not receivesInhibition(Y,T-1), time(T).\n";
+        parameterSymbols.resize(parameters.size());
         
-        file << "\ninhibited(Y,T) :- receivesInhibition(Y,T-1), not receivesActivation(Y,T-1), time(T).\n";
+        for(size_t i = 0; i < parameters.size(); ++i)
+            clingo_symbol_create_number(parameters[i], &parameterSymbols[i]);
         
-        file << "\n% this may not be needed, but it's a sanity check\n";
-        file << " :- activated(Y,T), inhibited(Y,T).\n";
+        clingo_part_t part = {partName.c_str(), parameterSymbols.data(), parameterSymbols.size()};
         
-        file << "\n% check consistency between graph and observations table\n";
+        if(!clingo_control_ground(control, &part, 1, nullptr, nullptr))
+        {
+            std::cout << "ERROR: clingo could not ground program part " << partName << ": " << clingo_error_message() << "..\n";
+            return false;
+        }
         
-        file << "\n% generate active and inactive for all genes based on graph propagation update\n";
+        return true;
+    }
+    
+    // optimizes for at most timeLimit seconds and returns the last (best) model, what "clasp --time-limit" does on the
+    // command line: SOLVE_MODEL_FOUND if there is one (optimal or not), SOLVE_TIME_LIMIT if none was found in time
+    // the shown activates/inhibits atoms go to edges and the repairCost(R,C) atoms to costs[R]
+    int SolveOnce(double timeLimit, std::vector<Edge> &edges, std::vector<unsigned int> &costs)
+    {
+        edges.clear();
+        costs.clear();
         
-        file << "\n% Y is inactive at time T if it was active at time T-1 and was inhibited at time T\n";
-        file << "inactive(Y,T) :- active(Y,T-1), inhibited(Y,T), time(T).\n";
+        if(!control)
+            return SOLVE_ERROR;
         
-        file << "\n% Y is active at time T if it was active at time T-1 and wasn't inhibited at time T\n";
-        file << "active(Y,T) :- active(Y,T-1), not inhibited(Y,T), time(T).\n";
+        ScopedTimer timer("clingo solve");
         
-        file << "\n% Y is active at time T if it was inactive at time T-1 and was activated at time T\n";
-        file << "active(Y,T) :- inactive(Y,T-1), activated(Y,T), time(T).\n";
+        clingo_solve_handle_t *handle = nullptr;
         
-        file << "\n% Y is inactive at time T if it was inactive at time T-1 and wasn't activated at time T\n";
-        file << "inactive(Y,T) :- inactive(Y,T-1), not activated(Y,T), time(T).\n";
+        if(!clingo_control_solve(control, clingo_solve_mode_async | clingo_solve_mode_yield, nullptr, 0, nullptr, nullptr, &handle))
+        {
+            std::cout << "ERROR: clingo could not start solving: " << clingo_error_message() << "..\n";
+            return SOLVE_ERROR;
+        }
         
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
         
-        file << "\n% consistency check: make sure the data generated by the graph doesn't create conflicts\n";
-        file << "% with the data in the table\n";
-        file << " :- active(Y,T), inactive(Y,T).\n";
+        bool modelFound = false;
         
-        if(rulesOfThumb)
+        // every yielded model improves on the previous one, keep going until the search is exhausted or time is up
+        while(true)
         {
+            double remainingSeconds = timeLimit - SecondsSince(start);
+            bool ready = false;
             
-            unsigned int timeSteps = geneNetwork.timeSteps;
-            unsigned int timeStepsPlus1 = timeSteps + 1;
-            size_t totalEdgesNum = geneNetwork.edges.size() + geneNetwork.addedEdges.size();
-            
-            file << "\n\nedgeAfterRepair(U,V) :- activates(U,V).\n";
-            file << "edgeAfterRepair(U,V) :- inhibits(U,V).";
-            
+            if(remainingSeconds > 0.0)
+                clingo_solve_handle_wait(handle, remainingSeconds, &ready);
             
-            // ***********************************************************
-            // RULE OF THUMB Nb. 1 => last time-step should be fixed state
-            // ***********************************************************
-            file << "\n\n% RULE OF THUMB Nb. 1 => last time-step should be fixed state\n";
-            for(size_t i = 0; i < tableSize; ++i)
+            if(!ready)
             {
-                if(geneNetwork.table[i].time == geneNetwork.timeSteps)
-                {
-                    if(geneNetwork.table[i].type == TABLE_TYPE::ACTIVE)
-                        file << "activePlus(" << geneNetwork.table[i].gene << "," << timeStepsPlus1 << ").\n";
-                    
-                    if(geneNetwork.table[i].type == TABLE_TYPE::INACTIVE)
-                        file << "inactivePlus(" << geneNetwork.table[i].gene << "," << timeStepsPlus1 << ").\n";
-                }
+                clingo_solve_handle_cancel(handle);
+                clingo_solve_handle_close(handle);
+                
+                return modelFound ? SOLVE_MODEL_FOUND : SOLVE_TIME_LIMIT;
             }
             
-            file << "\nactivated(Y," << timeStepsPlus1 << ") :- receivesActivation(Y," << timeSteps << "), not receivesInhibition(Y," << timeSteps << ").\n";
-            file << "inhibited(Y," << timeStepsPlus1 << ") :- receivesInhibition(Y," << timeSteps << "), not receivesActivation(Y," << timeSteps << ").\n";
-            
-            file << "\nisInactivePlus(Y," << timeStepsPlus1 << ") :- active(Y," << timeSteps << "), inhibited(Y," << timeStepsPlus1 << ").\n";
-            file << "isActivePlus(Y," << timeStepsPlus1 << ") :- active(Y," << timeSteps << "), not inhibited(Y," << timeStepsPlus1 << ").\n";
-            file << "isActivePlus(Y," << timeStepsPlus1 << ") :- inactive(Y," << timeSteps << "), activated(Y," << timeStepsPlus1 << ").\n";
-            file << "isInactivePlus(Y," << timeStepsPlus1 << ") :- inactive(Y," << timeSteps << "), not activated(Y," << timeStepsPlus1 << ").\n";
-            
-            file << "\n :- isActivePlus(Y," << timeStepsPlus1 << "), isInactivePlus(Y," << timeStepsPlus1 << ").\n";
-            
-            file << "\npenalty(1) :- activePlus(Y," << timeStepsPlus1 << "), isInactivePlus(Y," << timeStepsPlus1 << ").\n";
-            file << "penalty(1) :- inactivePlus(Y," << timeStepsPlus1 << "), isActivePlus(Y," << timeStepsPlus1 << ").\n";
-            
-            file << "\npenalty(1) :- activePlus(Y," << timeStepsPlus1 << "), not isActivePlus(Y," << timeStepsPlus1 << ").\n";
-            file << "penalty(1) :- inactivePlus(Y," << timeStepsPlus1 << "), not isInactivePlus(Y," << timeStepsPlus1 << ").\n";
-            file << "penalty(1) :- not activePlus(Y," << timeStepsPlus1 << "), isActivePlus(Y," << timeStepsPlus1 << ").\n";
-            file << "penalty(1) :- not inactivePlus(Y," << timeStepsPlus1 << "), isInactivePlus(Y," << timeStepsPlus1 << ").\n";
-            
-            file << "\nrepairCost(1," << totalEdgesNum << ") :- penalty(1).\n";
-            file << "repairCost(1,0) :- not penalty(1).\n";
-            
+            const clingo_model_t *model = nullptr;
             
-            // *********************************************************************************
-            // RULE OF THUMB Nb. 2 => limit the number of incoming and outgoing edges for a node
-            // *********************************************************************************
-            file << "\n\n% RULE OF THUMB Nb. 2 => limit the number of ingoing and outgoing edges for a node\n";
-            file << "kOut(C,X) :- X = #count{edgeAfterRepair(C,D)}, gene(C).\n";
-            file << "kIn(C,X) :- X = #count{edgeAfterRepair(D,C)}, gene(C).\n";
-            
-            file << "\nkDegree(C,Z) :- kIn(C,X), kOut(C,Y), Z=X+Y.\n";
-            
-            file << "\nkBadGene(C) :- kDegree(C,Z), Z < 4.\n";
-            file << "kBadGene(C) :- kDegree(C,Z), Z > 6.\n";
-            
-            file << "\nkBadGenes(X) :- X = #count{kBadGene(C)}.\n";
-            
-            file << "\nrepairCost(2,Y) :- kBadGenes(X), Y=X*" << (totalEdgesNum / geneNetwork.geneNum) << ".\n";
-            
-            
-            // ***********************************************************************
-            // RULE OF THUMB Nb. 3 => control the number of total edges in the network
-            // ***********************************************************************
-            file << "\n\n% RULE OF THUMB Nb. 3 => control the number of total edges in the network\n";
-            file << "nbOfEdges(X) :- X = #count{edgeAfterRepair(C,D)}.\n";
-            
-            file << "\nrepairCost(3," << totalEdgesNum << "):- nbOfEdges(X), X < 21.\n";
-            file << "repairCost(3," << totalEdgesNum << ") :- nbOfEdges(X), X > 25.\n";
-            file << "repairCost(3,0) :- nbOfEdges(X), X >= 21, X <= 25.\n";
-            
-            
-            // *******************************************************************************
-            // RULE OF THUMB Nb. 4 => more likely interactions based on state of gene in table
-            // *******************************************************************************
-            file << "\n\n% RULE OF THUMB Nb. 4 => more likely interactions based on state of gene in table\n";
-            
-            unsigned int halfTime = geneNetwork.timeSteps / 2;
-            
-            file << "likelyActivator(C) :- active(C,T), T <= " << halfTime << ".\n";
-            file << "likelyInhibitor(C) :- active(C,T), T > " << halfTime << ".\n";
-            
-            file << "\nlikelyWrongEdge(C,D) :- likelyActivator(C), inhibits(C,D), not likelyInhibitor(C), C != D.\n";
-            file << "likelyWrongEdge(C,D) :- likelyInhibitor(C), activates(C,D), not likelyActivator(C), C != D.\n";
-            
-            file << "\nlikelyWrongEdges(X) :- X = #count{likelyWrongEdge(C,D)}.\n";
-            
-            file << "\nrepairCost(4,X) :- likelyWrongEdges(Y), X=Y*1.\n";
-            
-            
-            // ***************************************************************
-            // RULE OF THUMB Nb. 5 => control over the diameter of the network
-            // ***************************************************************
-            
-            file << "\n\n% RULE OF THUMB Nb. 5 => control over the diameter of the network\n";
-            file << "% first make sure every gene can be reachable\n";
-            file << "link(X,Y) :- edgeAfterRepair(X,Y), X != Y.\n";
-            file << "link(Y,X) :- edgeAfterRepair(X,Y), Y != X.\n";
-            
-            file << "\nreachable(X) :- link(1,X).\n";
-            file << "reachable(Y) :- reachable(X), link(X,Y).\n";
-            
-            file << "\n:- gene(X), not reachable(X).\n";
-            
-            file << "\n% calculate diameter:\n";
-            file << "% find shortest distance between every pair of vertices\n";
-            file << "% diameter is the greatest value between these distances\n";
-            
-            for(size_t i = 0; i < 4; ++i)
+            if(!clingo_solve_handle_model(handle, &model))
             {
-                file << "dist(X,Y," << (i+1) << ") :- link(X,";
-                
-                
-                
-                for(size_t j = 0; j < i; ++j)
-                {
-                    std::string intermediate = GetNextIntermediateName();
-                    
-                    file << intermediate << "), link(" << intermediate << ",";
-                }
+                std::cout << "ERROR: clingo failed while solving: " << clingo_error_message() << "..\n";
+                clingo_solve_handle_close(handle);
                 
-                file << "Y), X != Y.\n";
+                return SOLVE_ERROR;
             }
             
-            file << "\nsmallestDist(X,Y,D) :- D = #min[dist(X,Y,C)=C], dist(X,Y,Z).\n";
-            
-            file << "\ndiameter(D) :- D = #max[smallestDist(X,Y,C)=C].\n";
-            
-            file << "\nrepairCost(5," << totalEdgesNum << ") :- diameter(D), D < 3.\n";
-            file << "repairCost(5," << totalEdgesNum << ") :- diameter(D), D > 4.\n";
-            file << "repairCost(5,0) :- diameter(D), D >= 3, D <= 4.\n";
-            
-            
-            // **********************************************
-            // RULE OF THUMB Nb. 6 => similar dominant motifs
-            // **********************************************
-            
-            file << "\n\n% RULE OF THUMB Nb. 6 => similar dominant motifs\n";
-            file << "\nmotif3(1,X,Y,Z) :- edge(X,Y), not edge(Y,X), edge(X,Z), not edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "motif3(2,X,Y,Z) :- not edge(X,Y), edge(Y,X), edge(X,Z), not edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "motif3(3,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), not edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "motif3(4,X,Y,Z) :- not edge(X,Y), not edge(Y,X), edge(X,Z), not edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "motif3(5,X,Y,Z) :- edge(X,Y), not edge(Y,X), edge(X,Z), not edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "motif3(6,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), not edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "motif3(7,X,Y,Z) :- edge(X,Y), edge(Y,X), not edge(X,Z), edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "%motif3(8,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), edge(Z,X), not edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "%motif3(9,X,Y,Z) :- edge(X,Y), not edge(Y,X), not edge(X,Z), edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "motif3(10,X,Y,Z) :- edge(X,Y), not edge(Y,X), edge(X,Z), edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "motif3(11,X,Y,Z) :- not edge(X,Y), edge(Y,X), edge(X,Z), edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "motif3(12,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), edge(Z,X), edge(Y,Z), not edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            file << "%motif3(13,X,Y,Z) :- edge(X,Y), edge(Y,X), edge(X,Z), edge(Z,X), edge(Y,Z), edge(Z,Y), X != Y, Y != Z, X != Z.\n";
-            
-            file << "\ndominantMotifs3(D) :- D = #count{motif3(I,X,Y,Z)}.\n";
+            // no more models: the last one is optimal (or there is none at all)
+            if(!model)
+                break;
             
-            file << "\npenaltyMotifs(C) :- dominantMotifs3(Z), C=" << totalEdgesNum << "-Z.\n";
+            ReadModel(model, edges, costs);
+            modelFound = true;
             
-            file << "\nrepairCost(6,C) :- penaltyMotifs(C), C > 0.\n";
-            file << "repairCost(6,0) :- penaltyMotifs(C), C <= 0.\n";
+            timer.Count("models", 1);
             
+            if(!clingo_solve_handle_resume(handle))
+            {
+                std::cout << "ERROR: clingo failed while solving: " << clingo_error_message() << "..\n";
+                clingo_solve_handle_close(handle);
+                
+                return SOLVE_ERROR;
+            }
+        }
+        
+        clingo_solve_handle_close(handle);
+        
+        return modelFound ? SOLVE_MODEL_FOUND : SOLVE_UNSATISFIABLE;
+    }
+    
+    // copies the shown atoms of a model (it is only valid until the search resumes)
+    void ReadModel(const clingo_model_t *model, std::vector<Edge> &edges, std::vector<unsigned int> &costs)
+    {
+        edges.clear();
+        costs.clear();
+        
+        size_t symbolsNum = 0;
+        clingo_model_symbols_size(model, clingo_show_type_shown, &symbolsNum);
+        
+        symbols.resize(symbolsNum);
+        clingo_model_symbols(model, clingo_show_type_shown, symbols.data(), symbolsNum);
+        
+        for(size_t i = 0; i < symbolsNum; ++i)
+        {
+            const char *name = nullptr;
+            const clingo_symbol_t *arguments = nullptr;
+            size_t argumentsNum = 0;
             
+            if(!clingo_symbol_name(symbols[i], &name) || !clingo_symbol_arguments(symbols[i], &arguments, &argumentsNum) || argumentsNum != 2)
+                continue;
             
+            int first = 0;
+            int second = 0;
             
-            // *********************
-            // END OF RULES OF THUMB
-            // *********************
+            if(!clingo_symbol_number(arguments[0], &first) || !clingo_symbol_number(arguments[1], &second))
+                continue;
             
+            if(strcmp(name, "activates") == 0)
+                edges.push_back(Edge(ACTIVATES, first, second));
+            else if(strcmp(name, "inhibits") == 0)
+                edges.push_back(Edge(INHIBITS, first, second));
+            else if(strcmp(name, "repairCost") == 0 && first >= 0 && first < (int)MAX_REPAIR_RULES)
+            {
+                if((size_t)first >= costs.size())
+                    costs.resize(first + 1, 0);
+                
+                costs[first] = second;
+            }
+        }
+    }
+    
+    clingo_control_t *control;
+    
+    std::vector<clingo_symbol_t> symbols; // reused between models
+    std::vector<clingo_symbol_t> parameterSymbols;
+};
+
+
+// gringo 3 constructs the clingo library can't parse: #sum[...]-style aggregates, #minimize[...], #hide
+// and #count{...} without a ":" (e.g. "#count{addEdge(U,V,_)}" instead of "#count{U,V : addEdge(U,V,_)}")
+bool UsesGringo3Syntax(const std::string &program)
+{
+    static const char *gringo3Keywords[] = {"#sum[", "#min[", "#max[", "#minimize[", "#maximize[", "#hide"};
+    
+    for(size_t i = 0; i < sizeof(gringo3Keywords) / sizeof(gringo3Keywords[0]); ++i)
+        if(program.find(gringo3Keywords[i]) != std::string::npos)
+            return true;
+    
+    for(size_t count = program.find("#count{"); count != std::string::npos; count = program.find("#count{", count + 1))
+    {
+        size_t close = program.find('}', count);
+        
+        if(close == std::string::npos || program.find(':', count) > close)
+            return true;
+    }
+    
+    return false;
+}
+
+
+// same loop as ElieRanking, but gringo/clasp run inside this process: the ASP file is read once, grounded once,
+// and every "better repair" constraint is grounded as a new instance of the "better" part of the same control object,
+// so nothing is written to disk but the best repair
+// NOTE: the library only accepts clingo 4+ syntax, write the ASP file with CreateASPfile(..., clingoSyntax = true)
+void ElieRankingInProcess(const std::string &aspFileName, const std::string &bestRepairFileName, const std::string &outputFileName)
+{
+    std::ifstream aspFile(aspFileName);
+    
+    if(!aspFile.is_open())
+    {
+        std::cout << "ERROR: Unable to open ASP file..\n";
+        return;
+    }
+    
+    // same as the gringo/clasp version: everything up to "#hide" is the program, the show statements are ours
+    std::string program;
+    std::string aspLine;
+    
+    while(getline(aspFile, aspLine))
+    {
+        if(aspLine.find("#hide") != std::string::npos)
+            break;
+        
+        program += aspLine;
+        program += "\n";
+    }
+    
+    aspFile.close();
+    
+    if(UsesGringo3Syntax(program))
+    {
+        std::cout << "ERROR: " << aspFileName << " is written in gringo 3 syntax, which the clingo library can't parse. "
+                  << "Create it with CreateASPfile(..., clingoSyntax = true), or use ElieRanking without inProcessSolver..\n";
+        return;
+    }
+    
+    program += "#show repairCost/2.\n";
+    program += "#show activates/2.\n";
+    program += "#show inhibits/2.\n";
+    
+    ClingoSolver solver;
+    
+    if(!solver.AddAndGround("base", program) || !solver.Add("better", CreateDominanceConstraint(true)))
+        return;
+    
+    std::vector<Edge> repairEdges;
+    std::vector<unsigned int> values;
+    
+    unsigned int changeCounter = 0;
+    bool repairFound = false;
+    
+    while(true)
+    {
+        int result = solver.SolveOnce(10.0, repairEdges, values);
+        
+        if(result == SOLVE_ERROR)
+            return;
+        
+        if(result == SOLVE_TIME_LIMIT)
+        {
+            std::cout << "\n\nTime limit reached. " << bestRepairFileName << " contains the best repair found. Exiting..\n\n\n";
+            break;
         }
         
+        if(result == SOLVE_UNSATISFIABLE)
+        {
+            std::cout << "\n\nNo better repair exists. " << bestRepairFileName << " contains the best repair found. Exiting..\n\n\n";
+            break;
+        }
         
-        file << "\n\n\n";
+        repairFound = true;
         
-        if(rulesOfThumb)
+        if(values.empty())
         {
-            file << "%totalCost(C) :- repairCost(0,C).\n";
-            file << "%totalCost(C) :- repairCost(1,C).\n";
-            file << "%totalCost(C) :- repairCost(2,C).\n";
-            file << "%totalCost(C) :- repairCost(3,C).\n";
-            file << "%totalCost(C) :- repairCost(4,C).\n";
-            file << "%totalCost(C) :- repairCost(5,C).\n";
-            file << "%totalCost(C) :- repairCost(6,C).\n";
+            std::cout << "ERROR: The repair has no repairCost atoms, so no better repair can be asked for..\n";
+            return;
         }
         
-        file << "totalCost(C) :- C = #sum[repairCost(_,X)=X].\n";
+        // rules missing from the answer set cost 0
+        values.resize(std::max(values.size(), (size_t)ASP_FILE_REPAIR_RULES), 0);
         
+        // write the best repair so far the way clasp prints it, so AnalyzeResult can read it
+        // (edges first, then the repairCost atoms)
+        std::ofstream bestRepairFile(bestRepairFileName);
         
-        file << "\n% minimize the number of applied repairs to the network graph\n";
-        file << "#minimize[totalCost(C)=C].\n";
+        if(!bestRepairFile.is_open())
+        {
+            std::cout << "ERROR: Unable to open repair file..\n";
+            return;
+        }
+        
+        std::string repairLine;
         
-        file << "\n#hide.\n";
-        file << "%#show add(U,V,S).\n";
-        file << "%#show remove(U,V,S).\n";
-        file << "#show activates(X,Y).\n";
-        file << "#show inhibits(X,Y).\n";
-        file << "%#show repairCost(R,X).\n";
-        file << "%#show totalCost(X).\n";
+        for(size_t i = 0; i < repairEdges.size(); ++i)
+        {
+            repairLine += (repairEdges[i].type == ACTIVATES) ? "activates(" : "inhibits(";
+            repairLine += std::to_string(repairEdges[i].from) + "," + std::to_string(repairEdges[i].to) + ") ";
+        }
         
+        for(size_t rule = 0; rule < values.size(); ++rule)
+            repairLine += "repairCost(" + std::to_string(rule) + "," + std::to_string(values[rule]) + ") ";
         
+        bestRepairFile << "Answer: 1\n" << repairLine << "\nSATISFIABLE\n";
+        bestRepairFile.close();
         
-        file.close();
+        std::cout << "Answer: " << changeCounter + 1 << "\n" << repairLine << std::endl;
+        
+        // the next repair has to improve on more rules than it worsens (same constraint as the file version)
+        // only this iteration's instances of "better" are grounded, learned nogoods from earlier solves are kept
+        for(size_t rule = 0; rule < values.size(); ++rule)
+        {
+            if(!solver.Ground("better", {(int)changeCounter, (int)rule, (int)values[rule]}))
+                return;
+        }
+        
+        if(!solver.Ground("betterCheck", {(int)changeCounter}))
+            return;
+        
+        ++changeCounter;
     }
-    else
+    
+    if(!repairFound)
     {
-        std::cout << "ERROR: Unable to create ASP file..\n";
+        std::cout << "ERROR: No repair was found within the time limit..\n";
         return;
     }
     
-    std::cout << "\n\nFINISHED CREATING ASP FILE!\n\n";
+    std::cout << "\n\nFINISHED ELIE'S RANKING APPROACH AND CREATED OUTPUT FILE!\n\n";
+    
+    // analyze the result we get
+    AnalyzeResult(bestRepairFileName, outputFileName);
 }
 
+#endif
 
 
-void StatisticalApproachWithSignificance(const std::string &randomRepairsFileName, const std::string &outputFileName)
+// "results/budding.txt" -> "results/<prefix>budding.txt" (the prefix goes on the name, not on the directory)
+std::string PrefixFileName(const std::string &prefix, const std::string &fileName)
 {
-    std::vector<Edge> originalEdges;
+    size_t nameBegin = fileName.rfind('/') + 1; // npos + 1 == 0: no directory
     
-    if(randomRepairsFileName.find("budding") != std::string::npos)
-        originalEdges = budding.edges;
-    else if(randomRepairsFileName.find("fission") != std::string::npos)
-        originalEdges = fission.edges;
-    else if(randomRepairsFileName.find("elegans") != std::string::npos)
-        originalEdges = elegans.edges;
-    else if(randomRepairsFileName.find("mammalian") != std::string::npos)
-        originalEdges = mammalian.edges;
-    else if(randomRepairsFileName.find("arabidopsis") != std::string::npos)
-        originalEdges = arabidopsis.edges;
+    return fileName.substr(0, nameBegin) + prefix + fileName.substr(nameBegin);
+}
+
+
+// inProcessSolver: use the clingo library (build with USE_CLINGO) instead of running ./gringo | clasp and going through a repair file
+// (only for ASP files in clingo 4+ syntax: CreateASPfile(..., clingoSyntax = true)); that path grounds the program once and
+// only grounds the new constraint each iteration
+// otherwise (gringo 3 files) gringo 3 has no multi-shot solving, so the whole program and every constraint so far are
+// grounded again each iteration
+// solversNum > 1: ground once per iteration and race that many clasp configurations (see RunSolverPortfolio)
+void ElieRanking(const std::string &aspFileName, const std::string &outputFileName, bool inProcessSolver = false, unsigned int solversNum = 1)
+{
+    ScopedTimer timer("ElieRanking", aspFileName);
     
-    std::ifstream randomRepairsFile(randomRepairsFileName);
-    std::ofstream outputFile(outputFileName);
+    // bestRepair_buddingElieRanking.txt for buddingElieRanking.txt, and so on
+    const std::string bestRepairFileName = PrefixFileName("bestRepair_", aspFileName);
+    
+    if(inProcessSolver)
+    {
+#ifdef USE_CLINGO
+        ElieRankingInProcess(aspFileName, bestRepairFileName, outputFileName);
+#else
+        std::cout << "ERROR: In-process solving needs a build with USE_CLINGO defined (and linked against libclingo)..\n";
+#endif
+        return;
+    }
     
-    std::string repairLine;
+    // the "better repair" constraints of every iteration go to their own file, given to gringo next to the ASP file
+    // (all working files are named after the ASP file, so rankings of different ASP files can run side by side)
+    const std::string constraintsFileName = PrefixFileName("rankingConstraints_", aspFileName);
+    const std::string repairFileName = PrefixFileName("repair_", aspFileName);
+    const std::string groundFileName = PrefixFileName("repairGround_", aspFileName);
     
-    std::vector<Repair> repairs;
+    // the ASP file only shows activates/inhibits, the constraints need the repairCost atoms of every repair too
+    std::ofstream constraintsFile(constraintsFileName);
     
-    unsigned int repairNumber = 0;
+    if(!constraintsFile.is_open())
+    {
+        std::cout << "ERROR: Unable to open ASP constraints file..\n";
+        return;
+    }
+    
+    constraintsFile << "#show repairCost(X,Y).\n\n";
+    constraintsFile.close();
+    
+    bool timeLimitReached = false;
+    unsigned int changeCounter = 0;
     
-    if(randomRepairsFile.is_open() && outputFile.is_open())
+    while(!timeLimitReached)
     {
-        while(getline(randomRepairsFile, repairLine))
+        std::vector<unsigned int> values;
+        
+        // run ASP solvers to get the next "better" answer set repair
+        std::string commandString;
+        
+        commandString += "./gringo ";
+        commandString += aspFileName;
+        commandString += " ";
+        commandString += constraintsFileName;
+        
+        // an iteration that was solved before (same ASP file, same constraints so far, same clasp command lines) comes
+        // from the solver cache
+        std::string solverArguments = (solversNum > 1) ? PortfolioSolverArguments(solversNum, 10, true) : ClaspCommand("", 10);
+        std::string cacheKey = SolverCacheKey({aspFileName, constraintsFileName}, solverArguments);
+        
+        if(FetchCachedResult(cacheKey, repairFileName) < 0)
         {
-            // search for Answer line
-            if(repairLine.find("Answer:") != std::string::npos)
+            int exitCode = -1;
+            
+            // grounded to a file first (and not piped to clasp), so grounding and solving are timed apart
+            commandString += " > " + groundFileName;
+            
+            std::chrono::steady_clock::time_point groundingStart = std::chrono::steady_clock::now();
+            
             {
-                outputFile << "\nRepair: " << repairNumber++ << "\n\n";
-                
-                // get the actual answer set line
-                getline(randomRepairsFile, repairLine);
-                
-                long startHere = repairLine.find_first_of("r");
-                
-                std::string repairEdgesString(repairLine, 0, startHere-1);
-                std::string repairCostString(repairLine, startHere, repairLine.size()-1);
-                
-                unsigned int rule0 = 0;
-                unsigned int rule1 = 0;
-                unsigned int rule2 = 0;
-                unsigned int rule3 = 0;
-                unsigned int rule4 = 0;
-                unsigned int rule5 = 0;
-                unsigned int rule6 = 0;
-                
-                // save rule costs for statistical approach
-                sscanf(repairCostString.c_str(), "repairCost(0,%d) repairCost(1,%d) repairCost(2,%d) repairCost(3,%d) repairCost(4,%d) repairCost(5,%d) repairCost(6,%d)", &rule0, &rule1, &rule2, &rule3, &rule4, &rule5, &rule6);
-                
-                repairs.push_back(Repair(rule0, rule1, rule2, rule3, rule4, rule5, rule6));
-                
-                // evaluate each repair, then pick the best one based on statistical approach
-                // I decided to evaluate all repairs in case we need to do some comparisons...
-                size_t pos1 = 0;
-                size_t pos2 = repairEdgesString.find_first_of(" ");
-                
-                std::string restOfRepairEdgesString;
-                
-                std::vector<Edge> resultEdges;
-                
-                // stop at the edge before the last (because the end of the line is not a ' ')
-                while(pos1 < pos2)
-                {
-                    std::string resultEdge = std::string(repairEdgesString, pos1, pos2-pos1);
-                    
-                    unsigned int edgeFrom;
-                    unsigned int edgeTo;
-                    
-                    if(resultEdge[0] == 'a')
-                    {
-                        sscanf(resultEdge.c_str(), "activates(%d,%d)", &edgeFrom, &edgeTo);
-                        resultEdges.push_back(Edge(ACTIVATES, edgeFrom, edgeTo));
-                    }
-                    else
-                    {
-                        sscanf(resultEdge.c_str(), "inhibits(%d,%d)", &edgeFrom, &edgeTo);
-                        resultEdges.push_back(Edge(INHIBITS, edgeFrom, edgeTo));
-                    }
-                    
-                    outputFile << resultEdge << " ";
-                    
-                    pos1 = pos2 + 1;
-                    
-                    restOfRepairEdgesString = std::string(repairEdgesString, pos1, repairEdgesString.size());
-                    pos2 += (restOfRepairEdgesString.find_first_of(" ") + 1);
-                }
-                
-                // Don't forget last edge
-                outputFile << restOfRepairEdgesString << "\n";
-                
-                unsigned int edgeFrom;
-                unsigned int edgeTo;
-                
-                if(restOfRepairEdgesString[0] == 'a')
-                {
-                    sscanf(restOfRepairEdgesString.c_str(), "activates(%d,%d)", &edgeFrom, &edgeTo);
-                    resultEdges.push_back(Edge(ACTIVATES, edgeFrom, edgeTo));
-                }
-                else
-                {
-                    sscanf(restOfRepairEdgesString.c_str(), "inhibits(%d,%d)", &edgeFrom, &edgeTo);
-                    resultEdges.push_back(Edge(INHIBITS, edgeFrom, edgeTo));
-                }
-                
-                float nbOfSimilarEdges = 0;
-                
-                for(size_t i = 0; i < resultEdges.size(); ++i)
-                {
-                    for(size_t j = 0; j < originalEdges.size(); ++j)
-                    {
-                        if(resultEdges[i] == originalEdges[j])
-                            nbOfSimilarEdges += 1;
-                    }
-                }
+                ScopedTimer groundingTimer("gringo", aspFileName);
                 
-                float precision = nbOfSimilarEdges / resultEdges.size();
-                float recall = nbOfSimilarEdges / originalEdges.size();
+                std::system(commandString.c_str());
                 
-                float f1_score = 2.0 * (precision * recall) / (precision + recall);
+                groundingTimer.Count("bytesWritten", TracedFileSize(groundFileName));
+            }
+            
+            double groundingSeconds = SecondsSince(groundingStart);
+            
+            if(solversNum > 1)
+            {
+                // optimize: the program has a #minimize, so like a single clasp the best model found is kept
+                exitCode = RunSolverPortfolio(groundFileName, repairFileName, solversNum, 10, true);
+            }
+            else
+            {
+                ScopedTimer solvingTimer("clasp", aspFileName);
                 
-                outputFile << "\nPrecision: " << nbOfSimilarEdges << " / " << resultEdges.size() << " = " << precision << " (Nb. of edges in repaired network that are from original network)\n";
-                outputFile << "Recall: " << nbOfSimilarEdges << " / " << originalEdges.size() << " = " << recall << " (Nb. of edges in original network, found in repaired network)\n";
+                std::string solverCommandString = ClaspCommand("", 10);
                 
-                outputFile << "\nF1-score = " << f1_score << "\n";
+                solverCommandString += " < " + groundFileName + " > " + repairFileName;
                 
-                float jaccardIndex = (float)nbOfSimilarEdges / ((float)originalEdges.size() + (float)resultEdges.size() - (float)nbOfSimilarEdges);
+                int status = std::system(solverCommandString.c_str());
                 
-                outputFile << "\nJaccard Index = " << jaccardIndex << " (Intersection of original and repaired network divided by their union)\n";
+                if(status != -1 && WIFEXITED(status))
+                    exitCode = WEXITSTATUS(status);
                 
-                outputFile << "\n";
+                solvingTimer.Count("bytesWritten", TracedFileSize(repairFileName));
             }
+            
+            RecordSolverStatistics(aspFileName, repairFileName, changeCounter, exitCode, groundingSeconds);
+            
+            StoreCachedResult(cacheKey, repairFileName, exitCode);
         }
+        else
+            timer.Count("cacheHits", 1);
         
-        // Pick the best repair based on statistical approach
+        timer.Count("iterations", 1);
         
-        float averages[7] = {0};
+        // the repair file is read once: time limit check, copy to the best repair file and rule penalties
+        AnswerSetReader repairFile;
         
-        size_t repairsNum = repairs.size();
-        for(size_t i = 0; i < repairsNum; ++i)
+        if(!repairFile.Open(repairFileName))
         {
-            averages[0] += repairs[i].ruleViolations[0];
-            averages[1] += repairs[i].ruleViolations[1];
-            averages[2] += repairs[i].ruleViolations[2];
-            averages[3] += repairs[i].ruleViolations[3];
-            averages[4] += repairs[i].ruleViolations[4];
-            averages[5] += repairs[i].ruleViolations[5];
-            averages[6] += repairs[i].ruleViolations[6];
+            std::cout << "ERROR: Unable to open repair file..\n";
+            return;
         }
         
-        for(size_t i = 0; i < 7; ++i)
-            averages[i] /= (float)repairsNum;
-        
-        
-        float variances[7] = {0};
-        
-        for(size_t i = 0; i < repairsNum; ++i)
+        // if time limit was reached, stop everything and exit
+        if(repairFile.Contains("UNKNOWN"))
         {
-            float value0 = (float)(repairs[i].ruleViolations[0]) - averages[0];
-            variances[0] += (value0 * value0);
-            
-            float value1 = (float)(repairs[i].ruleViolations[1]) - averages[1];
-            variances[1] += (value1 * value1);
+            std::cout << "\n\nTime limit reached. " << bestRepairFileName << " contains the best repair found. Exiting..\n\n\n";
+            timeLimitReached = true;
             
-            float value2 = (float)(repairs[i].ruleViolations[2]) - averages[2];
-            variances[2] += (value2 * value2);
+            std::cout << "\n\nFINISHED ELIE'S RANKING APPROACH AND CREATED OUTPUT FILE!\n\n";
             
-            float value3 = (float)(repairs[i].ruleViolations[3]) - averages[3];
-            variances[3] += (value3 * value3);
+            // analyze the result we get
+            AnalyzeResult(bestRepairFileName, outputFileName);
             
-            float value4 = (float)(repairs[i].ruleViolations[4]) - averages[4];
-            variances[4] += (value4 * value4);
-            
-            float value5 = (float)(repairs[i].ruleViolations[5]) - averages[5];
-            variances[5] += (value5 * value5);
-            
-            float value6 = (float)(repairs[i].ruleViolations[6]) - averages[6];
-            variances[6] += (value6 * value6);
+            return;
         }
         
-        for(size_t i = 0; i < 7; ++i)
-            variances[i] /= ((float)repairsNum - 1.0);
-        
-        float standardDeviations[7] = {0};
-        
-        for(size_t i = 0; i < 7; ++i)
-            standardDeviations[i] = sqrtf(variances[i]);
+        // read repair to get the penalty values of each rule
+        AnswerSet answerSet;
+        bool repairFound = false;
         
+        while(repairFile.Next(answerSet))
+        {
+            values = answerSet.repairCosts;
+            repairFound = true;
+            timer.Count("modelsParsed", 1);
+        }
         
-        for(size_t i = 0; i < repairsNum; ++i)
+        // no answer set: either no repair improves on the best one, or the solver failed
+        if(!repairFound)
         {
-            for(size_t j = 0; j < 7; ++j)
+            bool unsatisfiable = repairFile.Contains("UNSATISFIABLE");
+            repairFile.Close();
+            
+            if(!unsatisfiable || changeCounter == 0)
             {
-                if(standardDeviations[j] <= 0.000001f)
-                {
-                    repairs[i].zScores[j] = 0;
-                    continue;
-                }
-                
-                repairs[i].zScores[j] = ((float)(repairs[i].ruleViolations[j]) - averages[j]) / standardDeviations[j];
-                repairs[i].totalZScore += repairs[i].zScores[j];
+                std::cout << "ERROR: The solver did not return a repair, see " << repairFileName << "..\n";
+                return;
             }
+            
+            std::cout << "\n\nNo better repair exists. " << bestRepairFileName << " contains the best repair found. Exiting..\n\n\n";
+            std::cout << "\n\nFINISHED ELIE'S RANKING APPROACH AND CREATED OUTPUT FILE!\n\n";
+            
+            // analyze the result we get
+            AnalyzeResult(bestRepairFileName, outputFileName);
+            
+            return;
         }
         
-        // pick repair with smallest z-score as best repair
-        float smallestZScore = 999999.0f;
-        size_t bestRepair = 0;
-        
-        for(size_t i = 0; i < repairsNum; ++i)
+        if(values.empty())
         {
-            if(repairs[i].totalZScore < smallestZScore)
-            {
-                smallestZScore = repairs[i].totalZScore;
-                bestRepair = i;
-            }
+            std::cout << "ERROR: The repair has no repairCost atoms, so no better repair can be asked for..\n";
+            repairFile.Close();
+            return;
         }
         
-        outputFile << "\n\n\nBEST REPAIR:\n";
-        outputFile << "============\n\n";
+        // rules missing from the answer set cost 0
+        values.resize(std::max(values.size(), (size_t)ASP_FILE_REPAIR_RULES), 0);
         
-        outputFile << "Repair: " << bestRepair;
+        // a repair was found, make a copy of it (this is the best repair so far)
+        std::ofstream bestRepairFile(bestRepairFileName);
         
-        outputFile << "\n\nCost of rules: ";
+        if(bestRepairFile.is_open())
+        {
+            bestRepairFile.write(repairFile.file.data, repairFile.file.size);
+            std::cout.write(repairFile.file.data, repairFile.file.size);
+            
+            bestRepairFile.close();
+        }
+        else
+        {
+            std::cout << "ERROR: Unable to open repair file..\n";
+            return;
+        }
         
-        for(int i = 0; i < 7; ++i)
-            outputFile << repairs[bestRepair].ruleViolations[i] << " ";
+        repairFile.Close();
         
-        outputFile << "\n\n\n";
+        // add the constraints of this iteration to the constraints file (the ASP file itself is never rewritten)
+        std::ofstream constraintsFile(constraintsFileName, std::ios::app);
         
-        randomRepairsFile.close();
-        outputFile.close();
-    }
-    else
-    {
-        std::cout << "ERROR: Unable to open random repairs file or create output file..\n";
-        return;
+        if(constraintsFile.is_open())
+        {
+            constraintsFile << CreateDominanceConstraint(false, changeCounter, values);
+            constraintsFile.close();
+            
+            ++changeCounter;
+        }
+        else
+        {
+            std::cout << "ERROR: Unable to open ASP constraints file..\n";
+            return;
+        }
     }
     
-    std::cout << "\n\nFINISHED STATISTICAL APPROACH AND CREATED OUTPUT FILE!\n\n";
+    // analyze the result we get
+    AnalyzeResult(bestRepairFileName, outputFileName);
+    
+    std::cout << "\n\nSOLVERS DID NOT TIME OUT... NO REPAIR WAS FOUND WITHIN THE TIME LIMIT!\n\n";
+    std::cout << "\n\nFINISHED ELIE'S RANKING APPROACH AND CREATED OUTPUT FILE!\n\n";
 }
 
-void StatisticalApproachWithSignificance2(const std::string &randomRepairsFileName, const std::string &outputFileName)
+// *************************************************************************************************
+// Batch runner: the network x strategy x variant matrix of main(), run on a pool of worker threads.
+//
+//   ANALYZE_RESULT_JOB  result_<network><strategy>_<variant>.txt  -> FINALRESULT_<network><strategy>_<variant>.txt
+//                       (if the result file is missing, <network><strategy>_<variant>.txt is solved first)
+//   ELIE_RANKING_JOB    <network>ElieRanking.txt                  -> FINALRESULT_<network>ElieRanking.txt
+//                       (one per network: there is a single ElieRanking ASP file per network, whatever the variant)
+//
+// Every job reads and writes its own files, so jobs don't depend on each other. The networks have to
+// be loaded before (LoadNetworks), they are only read.
+// *************************************************************************************************
+
+enum BATCH_JOB_TYPE
 {
-    std::vector<Edge> originalEdges;
+    ANALYZE_RESULT_JOB = 0,
+    ELIE_RANKING_JOB,
+};
+
+struct BatchJob
+{
+    BatchJob(int Type, const std::string &AspFileName, const std::string &ResultFileName, const std::string &OutputFileName)
+    {
+        type = Type;
+        aspFileName = AspFileName;
+        resultFileName = ResultFileName;
+        outputFileName = OutputFileName;
+        
+        succeeded = false;
+    }
     
-    if(randomRepairsFileName.find("budding") != std::string::npos)
-        originalEdges = budding.edges;
-    else if(randomRepairsFileName.find("fission") != std::string::npos)
-        originalEdges = fission.edges;
-    else if(randomRepairsFileName.find("elegans") != std::string::npos)
-        originalEdges = elegans.edges;
-    else if(randomRepairsFileName.find("mammalian") != std::string::npos)
-        originalEdges = mammalian.edges;
-    else if(randomRepairsFileName.find("arabidopsis") != std::string::npos)
-        originalEdges = arabidopsis.edges;
+    int type;
     
-    std::ifstream randomRepairsFile(randomRepairsFileName);
-    std::ofstream outputFile(outputFileName);
+    std::string aspFileName;
+    std::string resultFileName; // only for ANALYZE_RESULT_JOB
+    std::string outputFileName;
     
-    std::string repairLine;
+    bool succeeded;
+};
+
+bool FileExists(const std::string &fileName)
+{
+    struct stat fileStat;
     
-    std::vector<Repair> repairs;
+    return stat(fileName.c_str(), &fileStat) == 0;
+}
+
+// every strategy of every network, for every variant (e.g. "80_20", "cons"), and one ElieRanking job per network
+void CreateExperimentMatrix(const std::vector<std::string> &networkNames, const std::vector<std::string> &variants, std::vector<BatchJob> &jobs)
+{
+    static const char *strategies[] = {"NoRules", "", "Leximin", "Leximax", "Statistical", "StatisticalMinimal", "StatisticalThreeMinimal"};
     
-    if(randomRepairsFile.is_open() && outputFile.is_open())
+    for(size_t n = 0; n < networkNames.size(); ++n)
     {
-        while(getline(randomRepairsFile, repairLine))
+        for(size_t v = 0; v < variants.size(); ++v)
         {
-            // search for Answer line
-            if(repairLine.find("Answer:") != std::string::npos)
+            for(size_t s = 0; s < sizeof(strategies) / sizeof(strategies[0]); ++s)
             {
-                // get the actual answer set line
-                getline(randomRepairsFile, repairLine);
-                
-                long startHere = repairLine.find_first_of("r");
-                
-                std::string repairEdgesString(repairLine, 0, startHere-1);
-                std::string repairCostString(repairLine, startHere, repairLine.size()-1);
-                
-                unsigned int rule0 = 0;
-                unsigned int rule1 = 0;
-                unsigned int rule2 = 0;
-                unsigned int rule3 = 0;
-                unsigned int rule4 = 0;
-                unsigned int rule5 = 0;
-                unsigned int rule6 = 0;
-                
-                // save rule costs for statistical approach
-                sscanf(repairCostString.c_str(), "repairCost(0,%d) repairCost(1,%d) repairCost(2,%d) repairCost(3,%d) repairCost(4,%d) repairCost(5,%d) repairCost(6,%d)", &rule0, &rule1, &rule2, &rule3, &rule4, &rule5, &rule6);
-                
-                repairs.push_back(Repair(rule0, rule1, rule2, rule3, rule4, rule5, rule6));
+                std::string experiment = networkNames[n] + strategies[s] + "_" + variants[v] + ".txt";
                 
+                jobs.push_back(BatchJob(ANALYZE_RESULT_JOB, experiment, "result_" + experiment, "FINALRESULT_" + experiment));
             }
         }
         
-        // Calculate averages and standard deviations
-        
-        float averages[7] = {0};
-        
-        size_t repairsNum = repairs.size();
-        for(size_t i = 0; i < repairsNum; ++i)
-        {
-            averages[0] += repairs[i].ruleViolations[0];
-            averages[1] += repairs[i].ruleViolations[1];
-            averages[2] += repairs[i].ruleViolations[2];
-            averages[3] += repairs[i].ruleViolations[3];
-            averages[4] += repairs[i].ruleViolations[4];
-            averages[5] += repairs[i].ruleViolations[5];
-            averages[6] += repairs[i].ruleViolations[6];
-        }
-        
-        for(size_t i = 0; i < 7; ++i)
-            averages[i] /= (float)repairsNum;
+        std::string experiment = networkNames[n] + "ElieRanking.txt";
         
-        
-        float variances[7] = {0};
-        
-        for(size_t i = 0; i < repairsNum; ++i)
+        jobs.push_back(BatchJob(ELIE_RANKING_JOB, experiment, "", "FINALRESULT_" + experiment));
+    }
+}
+
+void RunBatchJob(BatchJob &job, unsigned int solveTimeLimit)
+{
+    ScopedTimer timer("RunBatchJob", job.outputFileName);
+    
+    if(job.type == ELIE_RANKING_JOB)
+    {
+        if(!FileExists(job.aspFileName))
         {
-            float value0 = (float)(repairs[i].ruleViolations[0]) - averages[0];
-            variances[0] += (value0 * value0);
-            
-            float value1 = (float)(repairs[i].ruleViolations[1]) - averages[1];
-            variances[1] += (value1 * value1);
-            
-            float value2 = (float)(repairs[i].ruleViolations[2]) - averages[2];
-            variances[2] += (value2 * value2);
-            
-            float value3 = (float)(repairs[i].ruleViolations[3]) - averages[3];
-            variances[3] += (value3 * value3);
-            
-            float value4 = (float)(repairs[i].ruleViolations[4]) - averages[4];
-            variances[4] += (value4 * value4);
-            
-            float value5 = (float)(repairs[i].ruleViolations[5]) - averages[5];
-            variances[5] += (value5 * value5);
-            
-            float value6 = (float)(repairs[i].ruleViolations[6]) - averages[6];
-            variances[6] += (value6 * value6);
+            std::cout << "WARNING: Skipping " << job.outputFileName << ", " << job.aspFileName << " doesn't exist..\n";
+            return;
         }
         
-        for(size_t i = 0; i < 7; ++i)
-            variances[i] /= ((float)repairsNum - 1.0);
-        
-        float standardDeviations[7] = {0};
-        
-        for(size_t i = 0; i < 7; ++i)
-            standardDeviations[i] = sqrtf(variances[i]);
-        
-        
-        outputFile << "\n\nAVERAGES:\n";
-        outputFile << "=========\n\n";
-        
-        outputFile << "rule 0: " << averages[0] << "\n";
-        outputFile << "rule 1: " << averages[1] << "\n";
-        outputFile << "rule 2: " << averages[2] << "\n";
-        outputFile << "rule 3: " << averages[3] << "\n";
-        outputFile << "rule 4: " << averages[4] << "\n";
-        outputFile << "rule 5: " << averages[5] << "\n";
-        outputFile << "rule 6: " << averages[6] << "\n";
-        
-        outputFile << "\n\nSTANDARD DEVIATIONS:\n";
-        outputFile << "====================\n\n";
-        
-        outputFile << "rule 0: " << standardDeviations[0] << "\n";
-        outputFile << "rule 1: " << standardDeviations[1] << "\n";
-        outputFile << "rule 2: " << standardDeviations[2] << "\n";
-        outputFile << "rule 3: " << standardDeviations[3] << "\n";
-        outputFile << "rule 4: " << standardDeviations[4] << "\n";
-        outputFile << "rule 5: " << standardDeviations[5] << "\n";
-        outputFile << "rule 6: " << standardDeviations[6] << "\n";
-        
-        outputFile << "\n\nASP CODE:\n";
-        outputFile << "=========\n\n";
-        
-        std::vector<std::string> zScoreNames;
-        
-        for(int i = 0; i < 7; ++i)
+        ElieRanking(job.aspFileName, job.outputFileName);
+    }
+    else
+    {
+        if(!FileExists(job.resultFileName))
         {
-            if((averages[i] < 0.001) || (standardDeviations[i] < 0.1))
-                continue;
-            
-            outputFile << "cost" << i << "(X) :- repairCost(" << i << ",C), X=1000*C.\n";
-            outputFile << "diff" << i << "(D) :- cost" << i << "(X), D=X-" << (int)(averages[i]*1000) << ".\n";
-            outputFile << "zScore" << i << "(Z) :- diff" << i << "(D), Z=D/" << (int)(standardDeviations[i]*10) << ".\n\n";
-            
-            std::string zScoreName;
-            
-            zScoreName += "zScore";
-            zScoreName += std::to_string(i);
+            if(!FileExists(job.aspFileName))
+            {
+                std::cout << "WARNING: Skipping " << job.outputFileName << ", neither " << job.resultFileName << " nor " << job.aspFileName << " exists..\n";
+                return;
+            }
             
-            zScoreNames.push_back(zScoreName);
+            SolveWithPortfolio(job.aspFileName, job.resultFileName, 1, solveTimeLimit, true);
         }
         
-        if(zScoreNames.size() < 2)
+        AnalyzeResult(job.resultFileName, job.outputFileName);
+    }
+    
+    job.succeeded = FileExists(job.outputFileName);
+}
+
+// runs the jobs on threadsNum workers (0: one per core), then puts every FINALRESULT file, in job order, in summaryFileName
+void RunBatch(std::vector<BatchJob> &jobs, const std::string &summaryFileName, unsigned int solveTimeLimit = 600, unsigned int threadsNum = 0)
+{
+    if(threadsNum == 0)
+        threadsNum = std::thread::hardware_concurrency();
+    
+    threadsNum = std::max(1u, std::min(threadsNum, (unsigned int)jobs.size()));
+    
+    std::atomic<unsigned int> nextJob(0);
+    std::vector<std::thread> threads;
+    
+    for(unsigned int t = 0; t < threadsNum; ++t)
+    {
+        threads.push_back(std::thread([&]()
         {
-            std::cout << "ERROR: There is only 1 z-score greater than 0..\n";
-            return;
-        }
-        
-        
-        outputFile << "totalCost0(X) :- " << zScoreNames[0] << "(A), " << zScoreNames[1] << "(B), X=A+B.\n";
-        
-        size_t zScoreNum = zScoreNames.size();
-        size_t c;
-        
-        for(c = 2; c < zScoreNum; ++c)
+            unsigned int job;
+            while((job = nextJob++) < jobs.size())
+                RunBatchJob(jobs[job], solveTimeLimit);
+        }));
+    }
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+    
+    std::ofstream summaryFile(summaryFileName);
+    
+    if(!summaryFile.is_open())
+    {
+        std::cout << "ERROR: Unable to create batch summary file..\n";
+        return;
+    }
+    
+    unsigned int succeededNum = 0;
+    
+    for(size_t i = 0; i < jobs.size(); ++i)
+    {
+        if(!jobs[i].succeeded)
         {
-            outputFile << "totalCost" << (c - 1) << "(X) :- totalCost" << (c - 2) << "(A), " << zScoreNames[c] << "(B), X=A+B.\n";
+            summaryFile << "SKIPPED: " << jobs[i].outputFileName << " (no result or ASP file)\n\n";
+            continue;
         }
         
-        outputFile << "\ntotalCost(X) :- totalCost" << (c - 2) << "(X).\n\n";
-        
-        outputFile << "#minimize[totalCost(C)=C].\n\n";
-        
-        outputFile << "#hide.\n";
-        outputFile << "#show activates(X,Y).\n";
-        outputFile << "#show inhibits(X,Y).\n";
-        
+        ++succeededNum;
         
-        randomRepairsFile.close();
-        outputFile.close();
-    }
-    else
-    {
-        std::cout << "ERROR: Unable to open random repairs file or create output file..\n";
-        return;
+        summaryFile << "===== " << jobs[i].outputFileName << " =====\n\n";
+        summaryFile << std::ifstream(jobs[i].outputFileName).rdbuf() << "\n";
     }
     
-    std::cout << "\n\nFINISHED STATISTICAL APPROACH AND CREATED OUTPUT FILE!\n\n";
+    summaryFile.close();
+    
+    std::cout << "\n\nFINISHED BATCH: " << succeededNum << " of " << jobs.size() << " jobs created their output file (" << summaryFileName << ")!\n\n";
 }
 
 
-void ElieRanking(const std::string &aspFileName, const std::string &outputFileName)
+// *************************************************************************************************
+// Benchmark: generation -> grounding -> solving -> analysis for every network, corruption ratio and instance,
+// with each phase timed on its own. Every run adds one tab-separated line to the report:
+//
+//   network addedRatio removedRatio instance generationSeconds groundingSeconds solvingSeconds analysisSeconds
+//   groundBytes groundRules models solverExitCode f1Score jaccardIndex
+//
+// f1Score and jaccardIndex are those of the last (best) model, NA if there is none. Runs are made one after
+// the other so their timings don't compete for cores. The original networks have to be loaded before
+// (LoadNetworks(NOT_CORRUPTED)), they are only read.
+// *************************************************************************************************
+
+// size of a gringo 3 ground program (lparse format): its rules are the lines before the first "0" line
+bool ReadGroundProgramSize(const std::string &fileName, size_t &bytes, size_t &rulesNum)
 {
-    std::string bestRepairFileName;
+    MappedFile file;
     
-    if(aspFileName.find("budding") != std::string::npos)
-        bestRepairFileName = "bestRepair_buddingElieRanking.txt";
-    else if(aspFileName.find("fission") != std::string::npos)
-        bestRepairFileName = "bestRepair_fissionElieRanking.txt";
-    else if(aspFileName.find("elegans") != std::string::npos)
-        bestRepairFileName = "bestRepair_elegansElieRanking.txt";
-    else if(aspFileName.find("mammalian") != std::string::npos)
-        bestRepairFileName = "bestRepair_mammalianElieRanking.txt";
-    else if(aspFileName.find("arabidopsis") != std::string::npos)
-        bestRepairFileName = "bestRepair_arabidopsisElieRanking.txt";
+    bytes = 0;
+    rulesNum = 0;
     
-    bool timeLimitReached = false;
-    unsigned int changeCounter = 0;
+    if(!file.Open(fileName))
+        return false;
     
-    while(!timeLimitReached)
+    bytes = file.size;
+    
+    const char *position = file.data;
+    const char *fileEnd = file.data + file.size;
+    
+    while(position < fileEnd)
     {
-        int values[7] = {0};
+        const char *lineEnd = (const char *)memchr(position, '\n', fileEnd - position);
         
-        // run ASP solvers to get the next "better" answer set repair
-        std::string commandString;
-        
-        commandString += "./gringo ";
-        commandString += aspFileName;
-        commandString += " | clasp --time-limit=10 > repair.txt";
+        if(lineEnd == nullptr)
+            lineEnd = fileEnd;
         
-        std::system(commandString.c_str());
+        if(lineEnd - position == 1 && *position == '0')
+            break;
         
-        std::string repairLine;
+        ++rulesNum;
+        position = lineEnd + 1;
+    }
+    
+    return true;
+}
+
+struct BenchmarkRun
+{
+    BenchmarkRun(const std::string &Network, float AddedEdgesRatio, float RemovedEdgesRatio, unsigned int Instance)
+    {
+        network = Network;
+        addedEdgesRatio = AddedEdgesRatio;
+        removedEdgesRatio = RemovedEdgesRatio;
+        instance = Instance;
+        
+        generationSeconds = 0.0;
+        groundingSeconds = 0.0;
+        solvingSeconds = 0.0;
+        analysisSeconds = 0.0;
+        
+        groundBytes = 0;
+        groundRulesNum = 0;
+        modelsNum = 0;
+        solverExitCode = -1;
+        
+        f1Score = 0.0f;
+        jaccardIndex = 0.0f;
+    }
+    
+    std::string network;
+    float addedEdgesRatio;
+    float removedEdgesRatio;
+    unsigned int instance;
+    
+    double generationSeconds; // CorruptNetwork + CreateASPfile
+    double groundingSeconds;
+    double solvingSeconds;
+    double analysisSeconds; // AnalyzeResult
+    
+    size_t groundBytes;
+    size_t groundRulesNum;
+    size_t modelsNum;
+    int solverExitCode; // -1 if the program couldn't be grounded or solved
+    
+    float f1Score;
+    float jaccardIndex;
+};
+
+void RunBenchmarkInstance(const GeneNetwork &geneNetwork, BenchmarkRun &run, uint64_t seed, const std::string &directory, bool rulesOfThumb, unsigned int solveTimeLimit)
+{
+    std::string experiment = geneNetwork.name + "_" + std::to_string(std::lround(run.addedEdgesRatio * 100)) + "_" + std::to_string(std::lround(run.removedEdgesRatio * 100)) + "_" + std::to_string(run.instance) + ".txt";
+    
+    std::string aspFileName = directory + "/" + experiment;
+    std::string groundProgramFileName = aspFileName + ".ground";
+    std::string resultFileName = directory + "/result_" + experiment;
+    
+    ScopedTimer timer("RunBenchmarkInstance", experiment);
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    GeneNetwork corruptedNetwork = CorruptNetwork(geneNetwork, run.addedEdgesRatio, run.removedEdgesRatio, seed, run.instance);
+    CreateASPfile(corruptedNetwork, aspFileName, rulesOfThumb);
+    
+    run.generationSeconds = SecondsSince(start);
+    
+    start = std::chrono::steady_clock::now();
+    
+    {
+        ScopedTimer groundingTimer("gringo", aspFileName);
         
-        // check if time limit was reached before the solvers could find a better repair
-        std::ifstream repairFileCopyCheck("repair.txt");
+        std::string commandString = "./gringo " + aspFileName + " > " + groundProgramFileName;
         
-        if(repairFileCopyCheck.is_open())
-        {
-            while(getline(repairFileCopyCheck, repairLine))
-            {
-                // if time limit was reached, stop everything and exit
-                if(repairLine.find("UNKNOWN") != std::string::npos)
-                {
-                    std::cout << "\n\nTime limit reached. bestRepair.txt file contains the best repair found. Exiting..\n\n\n";
-                    repairFileCopyCheck.close();
-                    timeLimitReached = true;
-                    
-                    std::cout << "\n\nFINISHED ELIE'S RANKING APPROACH AND CREATED OUTPUT FILE!\n\n";
-                    
-                    // analyze the result we get
-                    AnalyzeResult(bestRepairFileName, outputFileName);
-                    
-                    return;
-                }
-            }
-        }
-        else
+        if(std::system(commandString.c_str()) != 0)
         {
-            std::cout << "ERROR: Unable to open repair file..\n";
+            std::cout << "ERROR: Unable to ground " << aspFileName << "..\n";
             return;
         }
+    }
+    
+    run.groundingSeconds = SecondsSince(start);
+    
+    ReadGroundProgramSize(groundProgramFileName, run.groundBytes, run.groundRulesNum);
+    
+    start = std::chrono::steady_clock::now();
+    
+    run.solverExitCode = RunSolverPortfolio(groundProgramFileName, resultFileName, 1, solveTimeLimit, true);
+    
+    run.solvingSeconds = SecondsSince(start);
+    
+    RecordSolverStatistics(aspFileName, resultFileName, 0, run.solverExitCode, run.groundingSeconds);
+    
+    std::remove(groundProgramFileName.c_str());
+    
+    if(run.solverExitCode < 0)
+        return;
+    
+    start = std::chrono::steady_clock::now();
+    
+    AnalyzeResult(resultFileName, directory + "/FINALRESULT_" + experiment);
+    
+    run.analysisSeconds = SecondsSince(start);
+    
+    // scores of the last model, with the formulas of AnalyzeResult
+    AnswerSetReader resultFile;
+    AnswerSet answerSet;
+    std::vector<Edge> lastEdges;
+    
+    if(!resultFile.Open(resultFileName))
+        return;
+    
+    while(resultFile.Next(answerSet))
+    {
+        lastEdges.swap(answerSet.edges);
+        ++run.modelsNum;
+    }
+    
+    if(run.modelsNum == 0)
+        return;
+    
+    EdgeSet originalEdgeSet;
+    originalEdgeSet.Build(geneNetwork.edges);
+    
+    float nbOfSimilarEdges = (float)originalEdgeSet.CountCommon(lastEdges);
+    
+    float precision = nbOfSimilarEdges / lastEdges.size();
+    float recall = nbOfSimilarEdges / geneNetwork.edges.size();
+    
+    run.f1Score = 2.0 * (precision * recall) / (precision + recall);
+    run.jaccardIndex = nbOfSimilarEdges / ((float)geneNetwork.edges.size() + (float)lastEdges.size() - nbOfSimilarEdges);
+}
+
+// instancesNum corrupted instances of every network for every (addedEdgesRatio, removedEdgesRatio) of the sweep,
+// working files in directory, one report line per run (written as soon as the run is over)
+void RunBenchmark(const std::vector<std::string> &networkNames, const std::vector<float> &addedEdgesRatios, const std::vector<float> &removedEdgesRatios, unsigned int instancesNum, uint64_t seed, const std::string &directory, const std::string &reportFileName, bool rulesOfThumb = false, unsigned int solveTimeLimit = 600)
+{
+    std::ofstream reportFile(reportFileName);
+    
+    if(!reportFile.is_open())
+    {
+        std::cout << "ERROR: Unable to create benchmark report..\n";
+        return;
+    }
+    
+    // (may already exist)
+    mkdir(directory.c_str(), 0755);
+    
+    reportFile << "network\taddedRatio\tremovedRatio\tinstance\tgenerationSeconds\tgroundingSeconds\tsolvingSeconds\tanalysisSeconds";
+    reportFile << "\tgroundBytes\tgroundRules\tmodels\tsolverExitCode\tf1Score\tjaccardIndex\n";
+    
+    unsigned int runsNum = 0;
+    
+    for(size_t n = 0; n < networkNames.size(); ++n)
+    {
+        GeneNetwork *geneNetwork = GetNetwork(networkNames[n]);
         
-        // if time limit was not reached, a repair was found, make a copy of it (this is the best repair so far)
-        std::ifstream repairFileCopy("repair.txt");
-        std::ofstream bestRepairFile(bestRepairFileName);
-        
-        if(repairFileCopy.is_open() && bestRepairFile.is_open())
-        {
-            while(getline(repairFileCopy, repairLine))
-            {
-                bestRepairFile << repairLine << std::endl;
-                std::cout << repairLine << std::endl;
-            }
-            
-            repairFileCopy.close();
-            repairFileCopyCheck.close();
-            bestRepairFile.close();
-        }
-        else
+        if(geneNetwork == nullptr || geneNetwork->edges.empty())
         {
-            std::cout << "ERROR: Unable to open repair file..\n";
-            return;
+            std::cout << "ERROR: Network " << networkNames[n] << " is unknown or not loaded..\n";
+            continue;
         }
         
-        std::ifstream repairFile("repair.txt");
+        // thcell keeps its hand-written added edges even when NOT_CORRUPTED, the sweep corrupts the original edges only
+        GeneNetwork originalNetwork(*geneNetwork);
+        originalNetwork.addedEdges.clear();
         
-        // read repair to get the penalty values of each rule
-        if(repairFile.is_open())
+        for(size_t a = 0; a < addedEdgesRatios.size(); ++a)
         {
-            while(getline(repairFile, repairLine))
+            for(size_t r = 0; r < removedEdgesRatios.size(); ++r)
             {
-                // search for Answer line
-                if(repairLine.find("Answer:") != std::string::npos)
+                for(unsigned int instance = 0; instance < instancesNum; ++instance)
                 {
-                    // get the actual answer set line
-                    getline(repairFile, repairLine);
+                    BenchmarkRun run(networkNames[n], addedEdgesRatios[a], removedEdgesRatios[r], instance);
                     
-                    long startHere = repairLine.find_first_of("r");
+                    RunBenchmarkInstance(originalNetwork, run, seed, directory, rulesOfThumb, solveTimeLimit);
                     
-                    std::string repairEdgesString(repairLine, 0, startHere-1);
-                    std::string repairCostString(repairLine, startHere, repairLine.size()-1);
+                    reportFile << run.network << "\t" << run.addedEdgesRatio << "\t" << run.removedEdgesRatio << "\t" << run.instance;
+                    reportFile << "\t" << run.generationSeconds << "\t" << run.groundingSeconds << "\t" << run.solvingSeconds << "\t" << run.analysisSeconds;
+                    reportFile << "\t" << run.groundBytes << "\t" << run.groundRulesNum << "\t" << run.modelsNum << "\t" << run.solverExitCode;
                     
-                    unsigned int rule0 = 0;
-                    unsigned int rule1 = 0;
-                    unsigned int rule2 = 0;
-                    unsigned int rule3 = 0;
-                    unsigned int rule4 = 0;
-                    unsigned int rule5 = 0;
-                    unsigned int rule6 = 0;
+                    if(run.modelsNum > 0)
+                        reportFile << "\t" << run.f1Score << "\t" << run.jaccardIndex << "\n";
+                    else
+                        reportFile << "\tNA\tNA\n";
                     
-                    // save rule penalties
-                    sscanf(repairCostString.c_str(), "repairCost(0,%d) repairCost(1,%d) repairCost(2,%d) repairCost(3,%d) repairCost(4,%d) repairCost(5,%d) repairCost(6,%d)", &rule0, &rule1, &rule2, &rule3, &rule4, &rule5, &rule6);
+                    reportFile.flush();
                     
-                    values[0] = rule0;
-                    values[1] = rule1;
-                    values[2] = rule2;
-                    values[3] = rule3;
-                    values[4] = rule4;
-                    values[5] = rule5;
-                    values[6] = rule6;
+                    ++runsNum;
                 }
             }
-            
-            repairFile.close();
-        }
-        else
-        {
-            std::cout << "ERROR: Unable to open repair file..\n";
-            return;
-        }
-        
-        // write new ASP file containing updated rule penalties
-        std::ifstream aspFile(aspFileName);
-        std::ofstream aspFileNew("newASP.txt");
-        
-        std::string aspLine;
-        
-        if(aspFile.is_open() && aspFileNew.is_open())
-        {
-            while(getline(aspFile, aspLine))
-            {
-                if(aspLine.find("#hide") == std::string::npos)
-                    aspFileNew << aspLine << std::endl;
-                else
-                    break;
-            }
-            
-            aspFileNew << "change" << changeCounter << "(0,-1) :- repairCost(0,X), X < " << values[0] << ".\n";
-            aspFileNew << "change" << changeCounter << "(1,-1) :- repairCost(1,X), X < " << values[1] << ".\n";
-            aspFileNew << "change" << changeCounter << "(2,-1) :- repairCost(2,X), X < " << values[2] << ".\n";
-            aspFileNew << "change" << changeCounter << "(3,-1) :- repairCost(3,X), X < " << values[3] << ".\n";
-            aspFileNew << "change" << changeCounter << "(4,-1) :- repairCost(4,X), X < " << values[4] << ".\n";
-            aspFileNew << "change" << changeCounter << "(5,-1) :- repairCost(5,X), X < " << values[5] << ".\n";
-            aspFileNew << "change" << changeCounter << "(6,-1) :- repairCost(6,X), X < " << values[6] << ".\n\n";
-            
-            aspFileNew << "change" << changeCounter << "(0,1) :- repairCost(0,X), X > " << values[0] << ".\n";
-            aspFileNew << "change" << changeCounter << "(1,1) :- repairCost(1,X), X > " << values[1] << ".\n";
-            aspFileNew << "change" << changeCounter << "(2,1) :- repairCost(2,X), X > " << values[2] << ".\n";
-            aspFileNew << "change" << changeCounter << "(3,1) :- repairCost(3,X), X > " << values[3] << ".\n";
-            aspFileNew << "change" << changeCounter << "(4,1) :- repairCost(4,X), X > " << values[4] << ".\n";
-            aspFileNew << "change" << changeCounter << "(5,1) :- repairCost(5,X), X > " << values[5] << ".\n";
-            aspFileNew << "change" << changeCounter << "(6,1) :- repairCost(6,X), X > " << values[6] << ".\n\n";
-            
-            aspFileNew << "totalChange" << changeCounter << "(C) :- C = #sum[change" << changeCounter << "(X,Y)=Y].\n\n";
-            
-            aspFileNew << " :- totalChange" << changeCounter << "(C), C >= 0.\n\n";
-            
-            aspFileNew << "#hide.\n";
-            aspFileNew << "#show repairCost(X,Y).\n";
-            aspFileNew << "#show activates(X,Y).\n";
-            aspFileNew << "#show inhibits(X,Y).\n";
-            
-            ++changeCounter;
-            
-            
-            // make the new ASP file as input file for next iteration
-            std::rename(aspFileName.c_str(), "oldASP.txt");
-            std::rename("newASP.txt", aspFileName.c_str());
-            
-            aspFile.close();
-            aspFileNew.close();
-        }
-        else
-        {
-            std::cout << "ERROR: Unable to open ASP file..\n";
-            return;
         }
     }
     
-    // analyze the result we get
-    AnalyzeResult(bestRepairFileName, outputFileName);
-    
-    std::cout << "\n\nSOLVERS DID NOT TIME OUT... NO REPAIR WAS FOUND WITHIN THE TIME LIMIT!\n\n";
-    std::cout << "\n\nFINISHED ELIE'S RANKING APPROACH AND CREATED OUTPUT FILE!\n\n";
+    std::cout << "\n\nFINISHED BENCHMARK: " << runsNum << " runs (" << reportFileName << ")!\n\n";
 }
 
+
 void FindAverages(const std::string &fileName)
 {
     std::ifstream file(fileName);
@@ -3187,9 +7913,44 @@ void FindAverages(const std::string &fileName)
 
 int main(int argc, const char * argv[])
 {
+    // repairInconsistentASP --benchmark [instances per ratio]: the reference networks at a sweep of corruption ratios
+    // (with a trace of every phase in BENCHMARK_trace.json)
+    if(argc > 1 && strcmp(argv[1], "--benchmark") == 0)
+    {
+        tracingEnabled = true;
+        
+        LoadNetworks(NOT_CORRUPTED);
+        
+        RunBenchmark({"budding", "fission", "elegans", "mammalian", "arabidopsis", "thcell"}, {0.2f, 0.4f, 0.6f, 0.8f}, {0.2f}, argc > 2 ? atoi(argv[2]) : 5, 2015, "benchmark", "BENCHMARK_report.tsv");
+        
+        WriteTrace("BENCHMARK_trace.json");
+        
+        return 0;
+    }
+    
+    //    tracingEnabled = true; // scoped timers of every phase, written by WriteTrace (open it in chrome://tracing)
+    
     //    LoadNetworks(NOT_CORRUPTED);
     //    LearnNetworkProperties("budding");
     
+    //    LoadNetworkFromDirectory("budding", "networks"); // loads networks/budding_edges.tsv, budding_addedEdges.tsv, budding_table.tsv
+    //    SaveNetworkToFiles(budding, "networks");
+    //    SaveNetworkSnapshot(budding, "budding.gnsnap");
+    //    LoadNetworkFromSnapshot("budding.gnsnap");
+    
+    //    LoadNetworks(CORRUPTED);
+    //    CreateConflictReport(budding, "conflicts_budding.txt");
+    
+    //    LoadNetworks(NOT_CORRUPTED);
+    //    CorruptNetworkInstances(budding, 0.8f, 0.2f, 1000, 2015, "corrupted"); // corrupted/budding_80_20_<0..999>_*.tsv
+    //    GeneNetwork buddingInstance = CorruptNetwork(budding, 0.8f, 0.2f, 2015, 17); // same as corrupted/budding_80_20_17_*.tsv
+    
+    //    GenerateSyntheticNetwork(synthetic, "synthetic", ERDOS_RENYI, 2000, 2.5f, 20, 2015, 30); // 2000 genes, diameter about 30
+    //    GenerateSyntheticNetwork(synthetic, "synthetic", SCALE_FREE, 5000, 3.0f, 20, 2015);
+    //    LearnNetworkProperties("synthetic");
+    //    CorruptNetworkInstances(synthetic, 0.8f, 0.2f, 10, 2015, "corrupted");
+    //    RunBenchmark({"synthetic"}, {0.2f, 0.8f}, {0.2f}, 3, 2015, "benchmark", "BENCHMARK_synthetic.tsv");
+    
     
     
     
@@ -3211,6 +7972,19 @@ int main(int argc, const char * argv[])
     //
     //    CreateASPfile(arabidopsis, "arabidopsis.txt", true);
     //    CreateASPfile(arabidopsis, "arabidopsisNoRules.txt", false);
+    //
+    //    CreateASPfile(thcell, "thcellNoRulesPruned.txt", false, true);
+    
+    
+    
+    
+    
+    //    LoadNetworks(NOT_CORRUPTED);
+    //
+    //    std::vector<BatchJob> jobs;
+    //    CreateExperimentMatrix({"budding", "fission", "elegans", "mammalian", "arabidopsis"}, {"80_20", "cons"}, jobs);
+    //    RunBatch(jobs, "FINALRESULT_batch.txt"); // solver calls that were made before come from solverCache/ (solverCacheEnabled)
+    //    WriteTrace("trace_batch.json");
     
     
     
@@ -3319,6 +8093,16 @@ int main(int argc, const char * argv[])
     //    StatisticalApproachWithSignificance2("threeMinimalRepairs_arabidopsis_80_20.txt", "ASP_arabidopsisStatistical_80_20.txt");
     
     
+    //    ParetoRanking("randomRepairs_mammalian_80_20.txt", "PARETO_mammalian_80_20.txt");
+    //    AnalyzeResult("PARETO_mammalian_80_20.txt", "FINALRESULT_mammalianPareto_80_20.txt");
+    
+    
+    //    LexicographicRanking("randomRepairs_mammalian_80_20.txt", "LEXIMIN_mammalian_80_20.txt", false);
+    //    LexicographicRanking("randomRepairs_mammalian_80_20.txt", "LEXIMAX_mammalian_80_20.txt", true);
+    //    AnalyzeResult("LEXIMIN_mammalian_80_20.txt", "FINALRESULT_mammalianLeximin_80_20.txt");
+    //    AnalyzeResult("LEXIMAX_mammalian_80_20.txt", "FINALRESULT_mammalianLeximax_80_20.txt");
+    
+    
     
     // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! WARNING: Straight forward. This automatically calls gringo and clasp and give the final result from here.
     // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! WARNING: Should have gringo in the debug folder and clasp on the machine path (/usr/bin).
@@ -3338,6 +8122,11 @@ int main(int argc, const char * argv[])
     //ElieRanking("mammalianElieRanking.txt", "FINALRESULT_mammalianElieRanking_cons.txt");
     //ElieRanking("arabidopsisElieRanking.txt", "FINALRESULT_arabidopsisElieRanking_cons.txt");
     
+    //ElieRanking("mammalianElieRanking.txt", "FINALRESULT_mammalianElieRanking_cons.txt", false, std::thread::hardware_concurrency()); // clasp portfolio
+    
+    //SolveWithPortfolio("mammalian.txt", "result_mammalian_cons.txt", std::thread::hardware_concurrency(), 600, true);
+    //AnalyzeResult("result_mammalian_cons.txt","FINALRESULT_mammalian.txt");
+    
     
     
     